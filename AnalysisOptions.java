@@ -0,0 +1,39 @@
+
+/**
+ * What an embedding tool wants from a call of Analyzer.analyze. Options
+ * are immutable, so one instance can be shared by every thread.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class AnalysisOptions
+{
+    public static final AnalysisOptions DEFAULT =
+        new AnalysisOptions(false, false);
+
+    public final boolean triage;  // skip generated, minified and binary
+                                  // files (see Triage); files only
+    public final boolean metrics; // collect the FunctionMetrics
+
+    public AnalysisOptions (boolean triage, boolean metrics)
+    {
+        this.triage = triage;
+        this.metrics = metrics;
+    }
+
+    /**
+     * @return these options with Triage turned on or off
+     */
+    public AnalysisOptions withTriage(boolean triage)
+    {
+        return new AnalysisOptions(triage, metrics);
+    }
+
+    /**
+     * @return these options with function metrics turned on or off
+     */
+    public AnalysisOptions withMetrics(boolean metrics)
+    {
+        return new AnalysisOptions(triage, metrics);
+    }
+}
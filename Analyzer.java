@@ -0,0 +1,296 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Runs the Scanner over one source file without printing anything and
+ * collects its findings. Shared by the batch drivers, and the API for
+ * tools that analyze files in their own JVM (see analyze(Path,
+ * AnalysisOptions)).
+ *
+ * Every call has its own Scanner, which holds all of the rules' state
+ * for one file, so calls from any number of threads are independent.
+ * The Readers the Scanner rewinds between passes and the buffer files
+ * are read into belong to the calling thread and are reused by its
+ * later calls. A Reader is checked out for the length of a call, so a
+ * call made while another is running on the same thread, e.g. from a
+ * ScanObserver, gets a Reader of its own.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class Analyzer
+{
+    private static final int MAX_POOLED_BYTES = 1 << 20;
+
+    // the thread's readers that no call is using
+    private static final ThreadLocal<ArrayDeque<CharSequenceReader>> READERS =
+        ThreadLocal.withInitial(ArrayDeque::new);
+    private static final ThreadLocal<byte[]> READ_BUFFERS =
+        ThreadLocal.withInitial(() -> new byte[Triage.HEAD_BYTES]);
+
+    /**
+     * Reads a whole source file, decoding it with the platform charset
+     * just as ScannerTester's InputStreamReader does.
+     *
+     * @param file the file to read
+     * @return the contents of the file
+     */
+    public static String readSource(File file) throws IOException
+    {
+        return new String(Files.readAllBytes(file.toPath()));
+    }
+
+    /**
+     * @param text any text
+     * @return its number of lines
+     */
+    public static int lines(CharSequence text)
+    {
+        int lines = 0;
+        for (int i = 0; i < text.length(); i++)
+        {
+            if (text.charAt(i) == '\n') lines++;
+        }
+        return lines;
+    }
+
+    /**
+     * Runs all six passes over the given source text.
+     *
+     * @param source the contents of a C or java file
+     * @return the findings, sorted by line
+     */
+    public static List<Scanner.Token> analyze(String source)
+        throws IOException
+    {
+        return analyze(source, "<input>", null, null);
+    }
+
+    /**
+     * Analyzes a file for an embedding tool, such as a build system,
+     * without printing anything. Safe to call from many threads at once.
+     *
+     * @param file the C or java file to analyze
+     * @param options what to do besides finding the diagnostics
+     * @return the diagnostics sorted by line, and the function metrics
+     *         and line count if asked for; or why the file was skipped or
+     *         could not be analyzed
+     */
+    public static FileResult analyze(Path file, AnalysisOptions options)
+    {
+        String path = file.toString();
+        try
+        {
+            long size = Files.size(file);
+            if (size > Integer.MAX_VALUE - 8)
+            {
+                return FileResult.failed(0, path, "File too large");
+            }
+            byte[] bytes = READ_BUFFERS.get();
+            if (bytes.length < size)
+            {
+                bytes = new byte[(int) size];
+                if (size <= MAX_POOLED_BYTES)
+                {
+                    READ_BUFFERS.set(bytes);
+                }
+            }
+            int length;
+            try (InputStream in = Files.newInputStream(file))
+            {
+                length = in.readNBytes(bytes, 0, (int) size);
+            }
+            Triage verdict = options.triage ? Triage.inspect(bytes,
+                Math.min(length, Triage.HEAD_BYTES)) : null;
+            if (verdict != null && verdict.skip)
+            {
+                return FileResult.skipped(0, path, verdict);
+            }
+            String source = new String(bytes, 0, length);
+            if (verdict != null)
+            {
+                return new FileResult(0, path,
+                    Triage.checkLineLengths(source), null, verdict);
+            }
+            return analyzeText(source, path, options);
+        }
+        catch (IOException | RuntimeException | StackOverflowError e)
+        {
+            return FileResult.failed(0, path, e.toString());
+        }
+    }
+
+    /**
+     * Analyzes text for an embedding tool, such as an editor holding a
+     * buffer, without printing anything or copying the text. Safe to call
+     * from many threads at once.
+     *
+     * @param source the contents of a C or java file
+     * @param options what to do besides finding the diagnostics; Triage
+     *        only applies to files
+     * @return the diagnostics sorted by line, and the function metrics
+     *         and line count if asked for; or why the text could not be
+     *         analyzed
+     */
+    public static FileResult analyze(CharSequence source,
+        AnalysisOptions options)
+    {
+        return analyzeText(source, "<input>", options);
+    }
+
+    private static FileResult analyzeText(CharSequence source, String path,
+        AnalysisOptions options)
+    {
+        try
+        {
+            ArrayList<FunctionMetrics> functions =
+                options.metrics ? new ArrayList<>() : null;
+            List<Scanner.Token> tokens =
+                analyze(source, path, null, functions);
+            return new FileResult(0, path, tokens, null, null, functions,
+                lines(source));
+        }
+        catch (IOException | RuntimeException | StackOverflowError e)
+        {
+            return FileResult.failed(0, path, e.toString());
+        }
+    }
+
+    /**
+     * Runs all six passes over the given source text.
+     *
+     * The text is read through one of the thread's CharSequenceReaders,
+     * whose mark has no read-ahead limit, so files of any size can be
+     * rewound between passes (ScannerTester's BufferedReader only marks
+     * 100000 chars).
+     * While a flight recording is running, the file, its passes and the
+     * matches of its expensive rules are recorded as FlightEvents.
+     *
+     * @param source the contents of a C or java file
+     * @param path the file the text came from, for the recordings
+     * @param trace records a span for each pass, or null
+     * @param functions receives the metrics of every function, or null
+     * @return the findings, sorted by line
+     */
+    public static List<Scanner.Token> analyze(CharSequence source,
+        String path, TraceRecorder trace, ArrayList<FunctionMetrics> functions)
+        throws IOException
+    {
+        ArrayDeque<CharSequenceReader> idle = READERS.get();
+        CharSequenceReader reader = idle.isEmpty()
+            ? new CharSequenceReader() : idle.pop();
+        reader.reset(source);
+        try
+        {
+            return runPasses(reader, source.length(), path, trace,
+                functions);
+        }
+        finally
+        {
+            reader.close(); // lets go of the text
+            idle.push(reader);
+        }
+    }
+
+    private static List<Scanner.Token> runPasses(CharSequenceReader reader,
+        int length, String path, TraceRecorder trace,
+        ArrayList<FunctionMetrics> functions) throws IOException
+    {
+        reader.mark(length + 1);
+        Scanner scanner = new Scanner(reader);
+        scanner.verbose = false;
+        scanner.functions = functions;
+        FlightEvents events = FlightEvents.fileStarted(path, length);
+        scanner.observer = events;
+        int pass = 1;
+        int passStart = 0; // findings before the current pass
+        int pushbackStart = 0;
+        long passTime = trace == null ? 0 : trace.now();
+        if (events != null)
+        {
+            events.passStarted(pass);
+        }
+        List<Scanner.Token> tokens = new ArrayList<>();
+        while (true)
+        {
+            Scanner.Token nextToken = scanner.nextToken();
+            boolean eof = nextToken.error.equals("EOF");
+            if ((events != null || trace != null)
+                && (eof || nextToken == Scanner.Token.PASS_END))
+            {
+                // a pass ends after the findings it left pending, which
+                // come out after the Scanner has begun the next pass
+                if (events != null)
+                {
+                    events.passFinished(pass, tokens.size() - passStart,
+                        scanner.pushbackCount - pushbackStart);
+                }
+                if (trace != null)
+                {
+                    trace.span("pass " + pass, path, passTime);
+                    passTime = trace.now();
+                }
+                pass++;
+                passStart = tokens.size();
+                pushbackStart = scanner.pushbackCount;
+                if (events != null && !eof)
+                {
+                    events.passStarted(pass);
+                }
+            }
+            if (eof)
+            {
+                break;
+            }
+            if (!nextToken.error.equals(""))
+            {
+                tokens.add(nextToken);
+            }
+        }
+        if (events != null)
+        {
+            events.fileFinished(tokens.size());
+        }
+        tokens.sort((a, b)->(a.line - b.line));
+        return tokens;
+    }
+
+    /**
+     * Reads and analyzes one file of a batch, running Triage on it first
+     * if asked to.
+     *
+     * @param index position of the file in the batch
+     * @param file the file to analyze
+     * @param triage whether to run Triage first
+     * @return its findings, or why it was skipped or could not be read
+     */
+    public static FileResult analyzeFile(int index, File file,
+        boolean triage)
+    {
+        String path = file.getPath();
+        try
+        {
+            Triage verdict = triage ? Triage.inspect(file) : null;
+            if (verdict != null && verdict.skip)
+            {
+                return FileResult.skipped(index, path, verdict);
+            }
+            String source = readSource(file);
+            List<Scanner.Token> tokens = verdict != null
+                ? Triage.checkLineLengths(source)
+                : analyze(source, path, null, null);
+            return new FileResult(index, path, tokens, null, verdict);
+        }
+        catch (IOException | RuntimeException | StackOverflowError e)
+        {
+            return FileResult.failed(index, path, e.toString());
+        }
+    }
+}
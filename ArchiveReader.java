@@ -0,0 +1,398 @@
+
+import java.io.BufferedInputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CompletableFuture;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.Semaphore;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.zip.GZIPInputStream;
+import java.util.zip.ZipEntry;
+import java.util.zip.ZipInputStream;
+
+/**
+ * Analyzes the sources inside zip, jar and tar (optionally gzipped)
+ * archives without extracting them. Each archive is read once, front to
+ * back, and decompressed on the fly; every source entry is read into its
+ * own buffer and handed to a pool of analyzing threads, with at most
+ * IN_FLIGHT_PER_THREAD entries per thread held in memory at a time. The
+ * results go to the batch's ResultSink in entry order, as soon as they
+ * are ready, from the thread that reads the archives, so the sink has a
+ * single writer. An entry larger than MAX_ENTRY_BYTES is not read and
+ * gets a failed result. Findings are reported as
+ * "archive!/path/in/archive".
+ *
+ * Tar archives are read with a small reader of our own, which knows the
+ * ustar, GNU long name and pax path headers.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ArchiveReader
+{
+    private static final String[] ARCHIVE_EXTENSIONS = {
+        ".zip", ".jar", ".tar", ".tar.gz", ".tgz"};
+    private static final int IN_FLIGHT_PER_THREAD = 2;
+    private static final int STREAM_BUFFER = 64 * 1024;
+    private static final int TAR_BLOCK = 512;
+    private static final int MAX_ENTRY_BYTES = Integer.MAX_VALUE - 8;
+
+    private final int threads;
+    private final boolean triage;
+    private final boolean metrics;
+
+    /**
+     * @param threads number of analyzing threads
+     * @param triage whether to run Triage on each entry first
+     * @param metrics whether to collect the metrics of every function
+     */
+    public ArchiveReader (int threads, boolean triage, boolean metrics)
+    {
+        this.threads = threads;
+        this.triage = triage;
+        this.metrics = metrics;
+    }
+
+    /**
+     * @param name a file name
+     * @return whether it names an archive this class can read
+     */
+    public static boolean isArchive(String name)
+    {
+        for (String extension : ARCHIVE_EXTENSIONS)
+        {
+            if (name.endsWith(extension))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Analyzes the source entries of every archive.
+     *
+     * @param archives the archives, in report order
+     * @param firstIndex batch index of the first entry
+     * @param sink receives one result per source entry, in archive and
+     *        entry order, on the calling thread; an archive that cannot
+     *        be read ends with a failed result
+     * @return the number of results
+     */
+    public int analyze(List<File> archives, int firstIndex, ResultSink sink)
+        throws InterruptedException
+    {
+        ExecutorService pool = Executors.newFixedThreadPool(threads);
+        Semaphore inFlight = new Semaphore(threads * IN_FLIGHT_PER_THREAD);
+        AtomicInteger entries = new AtomicInteger();
+        ArrayDeque<Future<FileResult>> pending = new ArrayDeque<>();
+        try
+        {
+            for (File archive : archives)
+            {
+                String name = archive.getName();
+                try (InputStream in = new BufferedInputStream(
+                    new FileInputStream(archive), STREAM_BUFFER))
+                {
+                    EntryHandler handler = new EntryHandler()
+                    {
+                        public void entry(String entry, byte[] contents)
+                            throws InterruptedException
+                        {
+                            int index = firstIndex + entries.getAndIncrement();
+                            String path = archive.getPath() + "!/" + entry;
+                            pending.add(pool.submit(() -> {
+                                try
+                                {
+                                    return analyzeEntry(index, path, contents);
+                                }
+                                finally
+                                {
+                                    inFlight.release();
+                                }
+                            }));
+                            deliver(pending, sink, false);
+                        }
+
+                        public void failed(String entry, String reason)
+                        {
+                            pending.add(CompletableFuture.completedFuture(
+                                FileResult.failed(firstIndex
+                                + entries.getAndIncrement(),
+                                archive.getPath() + "!/" + entry, reason)));
+                        }
+                    };
+                    if (name.endsWith(".zip") || name.endsWith(".jar"))
+                    {
+                        readZip(in, inFlight, handler);
+                    }
+                    else if (name.endsWith(".tar"))
+                    {
+                        readTar(in, inFlight, handler);
+                    }
+                    else
+                    {
+                        readTar(new GZIPInputStream(in, STREAM_BUFFER),
+                            inFlight, handler);
+                    }
+                }
+                catch (IOException e)
+                {
+                    pending.add(CompletableFuture.completedFuture(
+                        FileResult.failed(firstIndex
+                        + entries.getAndIncrement(), archive.getPath(),
+                        e.toString())));
+                }
+            }
+            deliver(pending, sink, true);
+            return entries.get();
+        }
+        finally
+        {
+            pool.shutdown();
+        }
+    }
+
+    /**
+     * Hands the results at the front of the queue to the sink: those that
+     * are ready, or all of them if wait is set.
+     */
+    private static void deliver(ArrayDeque<Future<FileResult>> pending,
+        ResultSink sink, boolean wait) throws InterruptedException
+    {
+        try
+        {
+            while (!pending.isEmpty() && (wait || pending.peek().isDone()))
+            {
+                sink.accept(pending.poll().get());
+            }
+        }
+        catch (ExecutionException e)
+        {
+            throw new IllegalStateException(e.getCause());
+        }
+    }
+
+    /**
+     * Receives the source entries of an archive.
+     */
+    private interface EntryHandler
+    {
+        /**
+         * @param name the entry's path in the archive
+         * @param contents the entry, holding one inFlight permit
+         */
+        void entry(String name, byte[] contents) throws InterruptedException;
+
+        /**
+         * @param name the entry's path in the archive
+         * @param reason why it was not read
+         */
+        void failed(String name, String reason);
+    }
+
+    private void readZip(InputStream in, Semaphore inFlight,
+        EntryHandler handler) throws IOException, InterruptedException
+    {
+        ZipInputStream zip = new ZipInputStream(in);
+        ZipEntry entry;
+        while ((entry = zip.getNextEntry()) != null)
+        {
+            if (!entry.isDirectory()
+                && BatchAnalyzer.isSource(entry.getName()))
+            {
+                if (entry.getSize() > MAX_ENTRY_BYTES)
+                {
+                    handler.failed(entry.getName(), "Entry too large");
+                    continue; // getNextEntry skips its data
+                }
+                inFlight.acquire();
+                byte[] contents;
+                try
+                {
+                    contents = zip.readNBytes(MAX_ENTRY_BYTES);
+                    if (zip.read() >= 0) // its size was not in the header
+                    {
+                        contents = null;
+                    }
+                }
+                catch (IOException e)
+                {
+                    inFlight.release();
+                    throw e;
+                }
+                if (contents == null)
+                {
+                    inFlight.release();
+                    handler.failed(entry.getName(), "Entry too large");
+                    continue;
+                }
+                handler.entry(entry.getName(), contents);
+            }
+        }
+    }
+
+    /**
+     * Reads a tar stream: a 512 byte header per entry followed by its
+     * contents padded to a whole block, ended by an all-zero block.
+     */
+    private void readTar(InputStream in, Semaphore inFlight,
+        EntryHandler handler) throws IOException, InterruptedException
+    {
+        byte[] header = new byte[TAR_BLOCK];
+        String longName = null; // from a GNU 'L' or pax 'x' entry
+        while (in.readNBytes(header, 0, TAR_BLOCK) == TAR_BLOCK
+            && header[0] != 0)
+        {
+            long size = tarSize(header);
+            long padding = (TAR_BLOCK - size % TAR_BLOCK) % TAR_BLOCK;
+            char type = (char) header[156];
+            if (type == 'L' || type == 'x')
+            {
+                String text = new String(in.readNBytes((int) size),
+                    StandardCharsets.UTF_8);
+                longName = type == 'L' ? text.replace("\0", "")
+                    : paxPath(text, longName);
+                in.skipNBytes(padding);
+                continue;
+            }
+            String name = longName != null ? longName : tarName(header);
+            longName = null;
+            boolean regular = type == '0' || type == 0 || type == '7';
+            boolean source = regular && BatchAnalyzer.isSource(name);
+            if (source && size > MAX_ENTRY_BYTES)
+            {
+                handler.failed(name, "Entry too large");
+                in.skipNBytes(size);
+            }
+            else if (source)
+            {
+                inFlight.acquire();
+                byte[] contents = in.readNBytes((int) size);
+                if (contents.length < size)
+                {
+                    inFlight.release();
+                    throw new IOException("Truncated entry: " + name);
+                }
+                handler.entry(name, contents);
+            }
+            else
+            {
+                in.skipNBytes(size);
+            }
+            in.skipNBytes(padding);
+        }
+    }
+
+    /**
+     * The name of a ustar entry: its prefix field, if any, then its name.
+     */
+    private static String tarName(byte[] header)
+    {
+        String name = tarString(header, 0, 100);
+        boolean ustar = tarString(header, 257, 6).startsWith("ustar");
+        String prefix = ustar ? tarString(header, 345, 155) : "";
+        return prefix.isEmpty() ? name : prefix + "/" + name;
+    }
+
+    private static String tarString(byte[] header, int offset, int length)
+    {
+        int end = offset;
+        while (end < offset + length && header[end] != 0)
+        {
+            end++;
+        }
+        return new String(header, offset, end - offset,
+            StandardCharsets.UTF_8);
+    }
+
+    /**
+     * The size field: octal digits, or a big-endian binary number if its
+     * high bit is set (GNU, for entries of 8 GB and more).
+     */
+    private static long tarSize(byte[] header) throws IOException
+    {
+        long size = 0;
+        if ((header[124] & 0x80) != 0)
+        {
+            for (int i = 125; i < 136; i++)
+            {
+                size = (size << 8) | (header[i] & 0xff);
+            }
+            return size;
+        }
+        for (int i = 124; i < 136; i++)
+        {
+            byte b = header[i];
+            if (b == 0 || b == ' ')
+            {
+                continue;
+            }
+            if (b < '0' || b > '7')
+            {
+                throw new IOException("Not a tar archive");
+            }
+            size = size * 8 + (b - '0');
+        }
+        return size;
+    }
+
+    /**
+     * Finds the path record, "LENGTH path=VALUE\n", in a pax header.
+     */
+    private static String paxPath(String records, String otherwise)
+    {
+        for (String record : records.split("\n"))
+        {
+            int equals = record.indexOf("=");
+            int space = record.indexOf(' ');
+            if (space >= 0 && equals > space
+                && record.substring(space + 1, equals).equals("path"))
+            {
+                return record.substring(equals + 1);
+            }
+        }
+        return otherwise;
+    }
+
+    /**
+     * Analyzes one entry just as the Pipeline analyzes a file.
+     */
+    private FileResult analyzeEntry(int index, String path, byte[] contents)
+    {
+        try
+        {
+            Triage verdict = triage ? Triage.inspect(contents,
+                Math.min(contents.length, Triage.HEAD_BYTES)) : null;
+            if (verdict != null && verdict.skip)
+            {
+                return FileResult.skipped(index, path, verdict);
+            }
+            String source = new String(contents);
+            if (verdict != null)
+            {
+                return new FileResult(index, path,
+                    Triage.checkLineLengths(source), null, verdict);
+            }
+            ArrayList<FunctionMetrics> functions =
+                metrics ? new ArrayList<>() : null;
+            List<Scanner.Token> tokens =
+                Analyzer.analyze(source, path, null, functions);
+            return new FileResult(index, path, tokens, null, null,
+                functions, Analyzer.lines(source));
+        }
+        catch (IOException | RuntimeException | Error e)
+        {
+            return FileResult.failed(index, path, e.toString());
+        }
+    }
+}
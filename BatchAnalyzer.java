@@ -0,0 +1,342 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Runs the Scanner over every C and java file under the given files and
+ * directories and prints one report, ordered by path. Zip, jar and tar
+ * archives named on the command line are analyzed without extracting
+ * them (see ArchiveReader), once the other files are done, with the
+ * same number of threads, and reported after them; sampled and budgeted
+ * runs leave them out.
+ *
+ * Usage: java BatchAnalyzer [options] <file or directory>...
+ *   --threads N        scan with N threads in this JVM (default: one per
+ *                      core; see Pipeline)
+ *   --processes N      analyze in N worker JVMs (see ShardCoordinator)
+ *   --worker-heap SIZE maximum heap of each worker, e.g. 256m
+ *   --timeout SECONDS  time a worker may spend on one file (default 60)
+ *   --no-triage        analyze generated, minified and binary files in
+ *                      full instead of skipping them (see Triage)
+ *   --sample           only estimate the findings per rule and directory
+ *                      from a random sample of the files (see Sampler)
+ *   --sample-size N    about how many files to sample (default 300)
+ *   --seed N           seed of the sample (default: the current time)
+ *   --budget TIME      stop analyzing at TIME after start (e.g. 2s,
+ *                      500ms), most recently changed files first (see
+ *                      BudgetedRun)
+ *   --cache FILE       remember the finding count of every file in FILE
+ *                      and use it to prioritize budgeted runs
+ *   --trace FILE       write a timeline of a --threads run to FILE in
+ *                      the Chrome trace format (see TraceRecorder)
+ *   --metrics FILE     write the size and complexity of every function
+ *                      of a --threads run to FILE, as CSV if it ends in
+ *                      .csv and as JSON Lines otherwise (see
+ *                      MetricsWriter)
+ *   --stats FILE       write the findings per rule, per directory (with
+ *                      the totals of its subdirectories) and per severity
+ *                      to FILE as CSV (see StatsRollup)
+ *   --history FILE     append the findings of the run to the history in
+ *                      FILE, for trends and diffs between runs (see
+ *                      ResultHistory)
+ *   --top K            after the report, list the K files and functions
+ *                      of a --threads run with the most findings per 100
+ *                      lines, overall and per rule (see TopK)
+ *   --spill-after N    write findings held back for the ordered report
+ *                      to temporary files once there are more than N
+ *                      (0: never; default: about a quarter of the heap;
+ *                      see OrderedReport)
+ *   --tokens DIR       cache the TokenStream of every file of a --threads
+ *                      run in DIR, keyed by content hash, for other tools;
+ *                      the cache is write-only for now: no run reads it
+ *   --progress         show files done, throughput, findings, time left
+ *                      and the slowest file of a --threads run on stderr
+ *                      (see ProgressReporter)
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class BatchAnalyzer
+{
+    private static final String[] SOURCE_EXTENSIONS = {".c", ".h", ".java"};
+
+    /**
+     * Parses the options, collects the files and runs the batch.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args)
+        throws IOException, InterruptedException
+    {
+        int threads = Runtime.getRuntime().availableProcessors();
+        int processes = 0;
+        String workerHeap = null;
+        long timeoutMillis = 60_000;
+        boolean triage = true;
+        boolean sample = false;
+        int sampleSize = 300;
+        long seed = System.currentTimeMillis();
+        long budgetNanos = 0;
+        String cachePath = null;
+        String tracePath = null;
+        String metricsPath = null;
+        String statsPath = null;
+        String historyPath = null;
+        int top = 0;
+        long spillAfter = -1;
+        String tokensPath = null;
+        boolean progress = false;
+        List<String> roots = new ArrayList<>();
+
+        try
+        {
+            for (int i = 0; i < args.length; i++)
+            {
+                switch (args[i])
+                {
+                    case "--threads":
+                        threads = Integer.parseInt(args[++i]);
+                        break;
+                    case "--processes":
+                        processes = Integer.parseInt(args[++i]);
+                        break;
+                    case "--worker-heap":
+                        workerHeap = args[++i];
+                        break;
+                    case "--timeout":
+                        timeoutMillis = 1000 * Long.parseLong(args[++i]);
+                        break;
+                    case "--no-triage":
+                        triage = false;
+                        break;
+                    case "--sample":
+                        sample = true;
+                        break;
+                    case "--sample-size":
+                        sampleSize = Integer.parseInt(args[++i]);
+                        break;
+                    case "--seed":
+                        seed = Long.parseLong(args[++i]);
+                        break;
+                    case "--budget":
+                        budgetNanos = BudgetedRun.parseDuration(args[++i]);
+                        break;
+                    case "--cache":
+                        cachePath = args[++i];
+                        break;
+                    case "--trace":
+                        tracePath = args[++i];
+                        break;
+                    case "--metrics":
+                        metricsPath = args[++i];
+                        break;
+                    case "--stats":
+                        statsPath = args[++i];
+                        break;
+                    case "--history":
+                        historyPath = args[++i];
+                        break;
+                    case "--top":
+                        top = Integer.parseInt(args[++i]);
+                        break;
+                    case "--spill-after":
+                        spillAfter = Long.parseLong(args[++i]);
+                        break;
+                    case "--tokens":
+                        tokensPath = args[++i];
+                        break;
+                    case "--progress":
+                        progress = true;
+                        break;
+                    default:
+                        roots.add(args[i]);
+                        break;
+                }
+            }
+        }
+        catch (ArrayIndexOutOfBoundsException | NumberFormatException e)
+        {
+            roots.clear();
+        }
+        if (roots.isEmpty())
+        {
+            System.out.println("Usage: java BatchAnalyzer [--threads N]"
+                + " [--processes N] [--worker-heap SIZE] [--timeout SECONDS]"
+                + " [--no-triage] [--sample [--sample-size N] [--seed N]]"
+                + " [--budget TIME] [--cache FILE] [--trace FILE]"
+                + " [--metrics FILE] [--stats FILE] [--history FILE]"
+                + " [--top K] [--spill-after N] [--tokens DIR] [--progress]"
+                + " <file or directory>...");
+            return;
+        }
+
+        List<File> files = new ArrayList<>();
+        List<File> archives = new ArrayList<>();
+        for (File file : collectSources(roots))
+        {
+            (ArchiveReader.isArchive(file.getName()) ? archives : files)
+                .add(file);
+        }
+        if (sample)
+        {
+            new Sampler(files, sampleSize, seed, Math.max(1, threads), triage)
+                .run(System.out);
+            return;
+        }
+        FindingCache cache = cachePath == null ? null
+            : FindingCache.load(new File(cachePath));
+        if (budgetNanos > 0)
+        {
+            new BudgetedRun(files, roots, budgetNanos, Math.max(1, threads),
+                triage, cache).run(System.out);
+        }
+        else
+        {
+            OrderedReport report = spillAfter < 0
+                ? new OrderedReport(System.out, files.size())
+                : new OrderedReport(System.out, files.size(), spillAfter);
+            MetricsWriter metrics = metricsPath == null ? null
+                : new MetricsWriter(new File(metricsPath));
+            StatsRollup stats = statsPath == null ? null : new StatsRollup();
+            ResultHistory history = historyPath == null ? null
+                : ResultHistory.open(new File(historyPath));
+            TopK ranking = top > 0 ? new TopK(top) : null;
+            ResultSink sink = result -> {
+                report.accept(result);
+                if (cache != null) cache.accept(result);
+                if (metrics != null) metrics.accept(result);
+                if (stats != null) stats.accept(result);
+                if (history != null) history.accept(result);
+                if (ranking != null) ranking.accept(result);
+            };
+            boolean functions = metrics != null || ranking != null;
+            if (processes > 0)
+            {
+                new ShardCoordinator(files, processes, workerHeap,
+                    timeoutMillis, sink, triage).run();
+            }
+            else
+            {
+                TraceRecorder trace =
+                    tracePath == null ? null : new TraceRecorder();
+                File tokenCache = tokensPath == null ? null
+                    : new File(tokensPath);
+                if (tokenCache != null)
+                {
+                    tokenCache.mkdirs();
+                }
+                ProgressReporter reporter = progress
+                    ? new ProgressReporter(files, Math.max(1, threads)) : null;
+                if (reporter != null)
+                {
+                    reporter.start();
+                }
+                Pipeline pipeline = new Pipeline(files, Math.max(1, threads),
+                    sink, triage, trace, functions, reporter, tokenCache);
+                pipeline.run();
+                if (reporter != null)
+                {
+                    reporter.finish();
+                }
+                if (pipeline.uncachedFiles() > 0)
+                {
+                    System.err.println(pipeline.uncachedFiles() + " files"
+                        + " could not be added to the token cache in "
+                        + tokensPath);
+                }
+                if (trace != null)
+                {
+                    trace.write(new File(tracePath));
+                }
+            }
+            new ArchiveReader(Math.max(1, threads), triage, functions)
+                .analyze(archives, files.size(), sink);
+            report.finish();
+            if (ranking != null)
+            {
+                ranking.print(System.out);
+            }
+            if (metrics != null)
+            {
+                metrics.close();
+            }
+            if (stats != null)
+            {
+                stats.write(new File(statsPath));
+            }
+            if (history != null)
+            {
+                history.append();
+            }
+        }
+        if (cache != null)
+        {
+            cache.save();
+        }
+    }
+
+    /**
+     * Lists the files to analyze. Files named on the command line are
+     * always included; directories are searched recursively for C and
+     * java sources, skipping hidden directories such as .git.
+     *
+     * @param roots files and directories from the command line
+     * @return the files, in a stable order
+     */
+    static List<File> collectSources(List<String> roots)
+    {
+        List<File> files = new ArrayList<>();
+        for (String root : roots)
+        {
+            File file = new File(root);
+            if (file.isDirectory())
+            {
+                collectDirectory(file, files);
+            }
+            else
+            {
+                files.add(file);
+            }
+        }
+        return files;
+    }
+
+    private static void collectDirectory(File directory, List<File> files)
+    {
+        File[] children = directory.listFiles();
+        if (children == null)
+        {
+            return;
+        }
+        Arrays.sort(children);
+        for (File child : children)
+        {
+            if (child.isDirectory())
+            {
+                if (!child.getName().startsWith("."))
+                {
+                    collectDirectory(child, files);
+                }
+            }
+            else if (isSource(child.getName()))
+            {
+                files.add(child);
+            }
+        }
+    }
+
+    static boolean isSource(String name)
+    {
+        for (String extension : SOURCE_EXTENSIONS)
+        {
+            if (name.endsWith(extension))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+}
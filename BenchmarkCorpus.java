@@ -0,0 +1,84 @@
+
+import java.io.File;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.Writer;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Random;
+
+/**
+ * Inputs of any size for the benchmarks, made by repeating a real source
+ * file (testInput.c unless another is given), so that their mix of
+ * comments, declarations, loops and findings stays that of real code.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class BenchmarkCorpus
+{
+    public static final String DEFAULT_SEED = "testInput.c";
+    private static final int MIN_FILE_CHARS = 1024;
+    private static final int MAX_FILE_CHARS = 256 * 1024;
+
+    private final String seed;
+
+    /**
+     * @param seedFile the source file to repeat
+     */
+    public BenchmarkCorpus (File seedFile) throws IOException
+    {
+        String text = Analyzer.readSource(seedFile);
+        this.seed = text.endsWith("\n") ? text : text + "\n";
+    }
+
+    /**
+     * @param chars about how long the source should be
+     * @return whole copies of the seed followed by the lines of one more
+     *         copy, at least chars long (or one line of the seed)
+     */
+    public String source(int chars)
+    {
+        StringBuilder text = new StringBuilder(chars + seed.length());
+        while (text.length() + seed.length() <= chars)
+        {
+            text.append(seed);
+        }
+        int end = 0;
+        while (text.length() + end < chars)
+        {
+            end = seed.indexOf('\n', end) + 1;
+        }
+        return text.append(seed, 0, Math.max(end, seed.indexOf('\n') + 1))
+            .toString();
+    }
+
+    /**
+     * Writes a batch of files whose sizes are spread evenly on a log
+     * scale from 1 KB to 256 KB.
+     *
+     * @param directory where the files are written
+     * @param count how many files
+     * @param randomSeed seed of the sizes, so that runs are comparable
+     * @return the files, in order
+     */
+    public List<File> writeBatch(File directory, int count, long randomSeed)
+        throws IOException
+    {
+        Random random = new Random(randomSeed);
+        List<File> files = new ArrayList<>(count);
+        double range = Math.log((double) MAX_FILE_CHARS / MIN_FILE_CHARS);
+        for (int i = 0; i < count; i++)
+        {
+            int chars = (int) (MIN_FILE_CHARS
+                * Math.exp(random.nextDouble() * range));
+            File file = new File(directory, String.format("file%05d.c", i));
+            try (Writer out = new FileWriter(file))
+            {
+                out.write(source(chars));
+            }
+            files.add(file);
+        }
+        return files;
+    }
+}
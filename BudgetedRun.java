@@ -0,0 +1,355 @@
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.PrintStream;
+import java.lang.management.ManagementFactory;
+import java.time.Duration;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.LinkedHashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+
+/**
+ * A batch run with a hard time limit, for hooks that must answer within
+ * a fixed latency.
+ *
+ * Files are analyzed most promising first: files with uncommitted
+ * changes and new files git does not know yet, then files in order of
+ * their last change in the recent git history, then the rest; ties go
+ * to the files with the most findings in the FindingCache. All cores
+ * work through that order until the deadline, which counts from the
+ * start of the JVM. Whatever was finished by then is reported, followed
+ * by what was left out.
+ *
+ * git runs in the directory of each root of the batch (the root itself,
+ * or the directory of a root that is a file), so the ranking does not
+ * depend on where the JVM was started and each root can be in its own
+ * repository. The git commands run side by side and get at most
+ * 1/GIT_SHARE of the time left. One that is slower than that (a huge
+ * repository, a slow file system) is stopped and its files are ranked
+ * by past findings alone, so git can never use up the budget.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class BudgetedRun
+{
+    private static final int GIT_HISTORY_COMMITS = 200;
+    private static final int GIT_SHARE = 4;
+    private static final long OUTPUT_RESERVE_NANOS = 50_000_000;
+    private static final int MAX_LISTED_SKIPS = 20;
+    // by rank: uncommitted changes, untracked files, recent history
+    private static final String[][] GIT_COMMANDS = {
+        {"git", "diff", "--name-only", "--relative", "HEAD"},
+        {"git", "ls-files", "--others", "--exclude-standard"},
+        {"git", "log", "--name-only", "--relative", "--pretty=format:", "-n",
+            String.valueOf(GIT_HISTORY_COMMITS)}};
+
+    private final List<File> files;
+    private final List<File> directories; // where git runs
+    private final long budgetNanos;
+    private final int threads;
+    private final boolean triage;
+    private final FindingCache cache; // may be null
+
+    /**
+     * @param files every file of the batch
+     * @param roots the files and directories named on the command line
+     * @param budgetNanos time allowed from JVM start to the report
+     * @param threads number of analyzing threads
+     * @param triage whether to run Triage on each file first
+     * @param cache past findings per file, or null
+     */
+    public BudgetedRun (List<File> files, List<String> roots,
+        long budgetNanos, int threads, boolean triage, FindingCache cache)
+    {
+        this.files = files;
+        Set<File> directories = new LinkedHashSet<>();
+        for (String root : roots)
+        {
+            File file = new File(root).getAbsoluteFile();
+            directories.add(file.isDirectory() ? file : file.getParentFile());
+        }
+        this.directories = new ArrayList<>(directories);
+        this.budgetNanos = budgetNanos;
+        this.threads = threads;
+        this.triage = triage;
+        this.cache = cache;
+    }
+
+    /**
+     * Parses a duration such as "2s", "1.5s", "500ms" or "1m".
+     *
+     * @param text the duration
+     * @return the duration in nanoseconds
+     */
+    public static long parseDuration(String text)
+    {
+        double scale = 1e9;
+        String number = text;
+        if (text.endsWith("ms"))
+        {
+            scale = 1e6;
+            number = text.substring(0, text.length() - 2);
+        }
+        else if (text.endsWith("s"))
+        {
+            number = text.substring(0, text.length() - 1);
+        }
+        else if (text.endsWith("m"))
+        {
+            scale = 60e9;
+            number = text.substring(0, text.length() - 1);
+        }
+        return (long) (Double.parseDouble(number) * scale);
+    }
+
+    /**
+     * Analyzes files in priority order until the deadline and prints
+     * what was covered and what was not.
+     *
+     * @param out where the report is printed
+     */
+    public void run(PrintStream out) throws InterruptedException
+    {
+        long uptime = TimeUnit.MILLISECONDS.toNanos(
+            ManagementFactory.getRuntimeMXBean().getUptime());
+        long deadline = System.nanoTime() + budgetNanos - uptime
+            - OUTPUT_RESERVE_NANOS;
+
+        List<Integer> order = prioritize(deadline);
+        AtomicReferenceArray<FileResult> results =
+            new AtomicReferenceArray<>(order.size());
+        AtomicInteger next = new AtomicInteger();
+        CountDownLatch finished = new CountDownLatch(threads);
+        for (int i = 0; i < threads; i++)
+        {
+            Thread worker = new Thread(() -> {
+                try
+                {
+                    int p;
+                    while (System.nanoTime() < deadline
+                        && (p = next.getAndIncrement()) < order.size())
+                    {
+                        int index = order.get(p);
+                        results.set(p, Analyzer.analyzeFile(index,
+                            files.get(index), triage));
+                    }
+                }
+                finally
+                {
+                    finished.countDown();
+                }
+            }, "budget-" + i);
+            worker.setDaemon(true); // abandoned at the deadline
+            worker.start();
+        }
+        finished.await(Math.max(0, deadline - System.nanoTime()),
+            TimeUnit.NANOSECONDS);
+
+        List<FileResult> covered = new ArrayList<>();
+        List<String> skipped = new ArrayList<>();
+        for (int p = 0; p < order.size(); p++)
+        {
+            FileResult result = results.get(p);
+            if (result != null)
+            {
+                covered.add(result);
+            }
+            else
+            {
+                skipped.add(files.get(order.get(p)).getPath());
+            }
+        }
+
+        covered.sort((a, b)->(a.index - b.index));
+        OrderedReport report = new OrderedReport(out, covered.size());
+        for (int i = 0; i < covered.size(); i++)
+        {
+            FileResult result = covered.get(i);
+            report.accept(new FileResult(i, result.path, result.tokens,
+                result.failure, result.triage));
+            if (cache != null)
+            {
+                cache.accept(result);
+            }
+        }
+        report.finish();
+
+        out.printf("Budget of %d ms: covered %d of %d files, skipped %d\n",
+            TimeUnit.NANOSECONDS.toMillis(budgetNanos), covered.size(),
+            files.size(), skipped.size());
+        for (String path : skipped.subList(0,
+            Math.min(MAX_LISTED_SKIPS, skipped.size())))
+        {
+            out.println("Not analyzed: " + path);
+        }
+        if (skipped.size() > MAX_LISTED_SKIPS)
+        {
+            out.printf("(and %d more)\n", skipped.size() - MAX_LISTED_SKIPS);
+        }
+    }
+
+    /**
+     * Orders the files by recency of change in git, then by past
+     * findings, then by path.
+     */
+    private List<Integer> prioritize(long deadline)
+        throws InterruptedException
+    {
+        Map<String, Integer> recency = gitRecency(directories,
+            System.nanoTime()
+            + Math.max(0, deadline - System.nanoTime()) / GIT_SHARE);
+        int[] rank = new int[files.size()];
+        int[] past = new int[files.size()];
+        List<Integer> order = new ArrayList<>(files.size());
+        for (int i = 0; i < files.size(); i++)
+        {
+            File file = files.get(i);
+            rank[i] = recency.getOrDefault(FindingCache.key(file),
+                Integer.MAX_VALUE);
+            past[i] = cache == null ? 0 : cache.findings(file);
+            order.add(i);
+        }
+        order.sort((a, b)->{
+            if (rank[a] != rank[b]) return Integer.compare(rank[a], rank[b]);
+            if (past[a] != past[b]) return Integer.compare(past[b], past[a]);
+            return Integer.compare(a, b);
+        });
+        return order;
+    }
+
+    /**
+     * Ranks files by how recently they changed: uncommitted changes and
+     * untracked files first, then the files of each of the last
+     * GIT_HISTORY_COMMITS commits, newest first.
+     *
+     * @param directories where to run git; its paths are relative to them
+     * @param limit System.nanoTime() by which git must have answered
+     * @return rank by FindingCache key; empty outside a git repository
+     */
+    private static Map<String, Integer> gitRecency(List<File> directories,
+        long limit) throws InterruptedException
+    {
+        List<GitPaths> commands = new ArrayList<>(); // by rank, directory
+        for (String[] command : GIT_COMMANDS)
+        {
+            for (File directory : directories)
+            {
+                commands.add(new GitPaths(directory, command));
+            }
+        }
+        Map<String, Integer> recency = new HashMap<>();
+        try
+        {
+            for (GitPaths command : commands)
+            {
+                List<String> paths = command.await(limit);
+                if (paths == null)
+                {
+                    continue; // fall back to past findings for these
+                }
+                for (String path : paths)
+                {
+                    recency.putIfAbsent(FindingCache.key(
+                        new File(command.directory, path)), recency.size());
+                }
+            }
+        }
+        finally
+        {
+            for (GitPaths command : commands)
+            {
+                command.stop();
+            }
+        }
+        return recency;
+    }
+
+    /**
+     * A git command started in the background, whose output is collected
+     * by a virtual thread while the other commands run.
+     */
+    private static class GitPaths
+    {
+        final File directory;
+        private final Process process; // null if git could not be started
+        private final Thread reader;
+        private final List<String> paths = new ArrayList<>();
+
+        GitPaths (File directory, String... command)
+        {
+            this.directory = directory;
+            Process started = null;
+            try
+            {
+                started = new ProcessBuilder(command)
+                    .directory(directory)
+                    .redirectError(ProcessBuilder.Redirect.DISCARD)
+                    .start();
+            }
+            catch (IOException e)
+            {
+                // no git: fall back to past findings alone
+            }
+            this.process = started;
+            this.reader = started == null ? null
+                : Thread.ofVirtual().start(this::read);
+        }
+
+        private void read()
+        {
+            try (BufferedReader in = new BufferedReader(
+                new InputStreamReader(process.getInputStream())))
+            {
+                String line;
+                while ((line = in.readLine()) != null)
+                {
+                    if (!line.isEmpty())
+                    {
+                        paths.add(line);
+                    }
+                }
+            }
+            catch (IOException e)
+            {
+                // stopped at the time limit
+            }
+        }
+
+        /**
+         * @param limit System.nanoTime() by which git must have finished
+         * @return the paths git printed, or null if it failed or was too
+         *         slow
+         */
+        List<String> await(long limit) throws InterruptedException
+        {
+            if (process == null
+                || !process.waitFor(Math.max(0, limit - System.nanoTime()),
+                    TimeUnit.NANOSECONDS)
+                || !reader.join(Duration.ofNanos(
+                    Math.max(0, limit - System.nanoTime())))
+                || process.exitValue() != 0)
+            {
+                return null;
+            }
+            return paths;
+        }
+
+        void stop()
+        {
+            if (process != null)
+            {
+                process.destroyForcibly();
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+
+import java.io.Reader;
+
+/**
+ * A Reader over any CharSequence, such as an editor's StringBuilder,
+ * without copying it into a String. Its mark has no read-ahead limit,
+ * so the Scanner can rewind it between passes, and it can be pointed at
+ * new text, so each thread can keep one.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class CharSequenceReader extends Reader
+{
+    private CharSequence text = "";
+    private int position = 0;
+    private int mark = 0;
+
+    /**
+     * Starts reading new text from its beginning.
+     *
+     * @param text the text to read
+     */
+    public void reset(CharSequence text)
+    {
+        this.text = text;
+        this.position = 0;
+        this.mark = 0;
+    }
+
+    public int read(char[] buffer, int offset, int length)
+    {
+        if (position >= text.length())
+        {
+            return -1;
+        }
+        int count = Math.min(length, text.length() - position);
+        if (text instanceof String)
+        {
+            ((String) text).getChars(position, position + count, buffer,
+                offset);
+        }
+        else if (text instanceof StringBuilder)
+        {
+            ((StringBuilder) text).getChars(position, position + count,
+                buffer, offset);
+        }
+        else
+        {
+            for (int i = 0; i < count; i++)
+            {
+                buffer[offset + i] = text.charAt(position + i);
+            }
+        }
+        position += count;
+        return count;
+    }
+
+    public boolean markSupported()
+    {
+        return true;
+    }
+
+    public void mark(int readAheadLimit)
+    {
+        mark = position;
+    }
+
+    public void reset()
+    {
+        position = mark;
+    }
+
+    /**
+     * Lets go of the text; the reader can still be pointed at new text.
+     */
+    public void close()
+    {
+        text = "";
+        position = 0;
+        mark = 0;
+    }
+}
@@ -0,0 +1,243 @@
+
+import java.util.BitSet;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.Set;
+import java.util.regex.Pattern;
+
+/**
+ * The named constants of a file, collected line by line in PASS1 so that
+ * PASS4 can tell a magic number from the definition of a constant.
+ *
+ * Constants are "#define NAME value", declarations marked const or final
+ * and enum members. Only a line that starts an enum ("enum [Name] {", or
+ * "enum Name" alone with the brace on the next line) opens an enum body;
+ * a variable or parameter of an enum type does not. The lines on which
+ * they are defined, including the continuation lines of a multi-line
+ * initializer and the whole body of an enum, are remembered so that
+ * their literals are never flagged; the constants themselves are hashed
+ * by value so that a magic number can name the constant that should
+ * replace it.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ConstantTable
+{
+    // what may follow "enum" on the line that starts an enum
+    private static final Pattern ENUM_HEAD = Pattern.compile(
+        "[ \t\f]*([A-Za-z_][A-Za-z0-9_]*)?[ \t\f]*"
+        + "(\\{.*|implements[^;=()]*)?");
+    // words that can come before "name[" in a statement that indexes
+    // an array rather than declaring one
+    private static final Set<String> STATEMENT_WORDS = Set.of("return",
+        "case", "throw", "else", "do", "goto", "sizeof", "delete", "yield",
+        "assert");
+
+    private final Map<String, String> names = new HashMap<>(); // value ->
+                                                               // first name
+    private final BitSet definitions = new BitSet(); // by line number
+    private int depth = 0;             // braces open
+    private int enumDepth = -1;        // depth around the enum body, or -1
+    private boolean enumPending = false;  // "enum" seen but not its '{'
+    private boolean initializer = false;  // a definition continues
+
+    /**
+     * Reads one line of code in PASS1.
+     *
+     * @param code the line, without its indentation or comment
+     * @param line its line number
+     */
+    public void line(String code, int line)
+    {
+        if (code.isEmpty())
+        {
+            return;
+        }
+        if (enumPending && !code.startsWith("{"))
+        {
+            enumPending = false; // "enum Name" was not followed by a body
+        }
+        boolean definition = initializer || enumPending || enumDepth >= 0;
+        if (code.startsWith("#define"))
+        {
+            String[] parts = code.split("[ \t\f]+", 3);
+            if (parts.length == 3)
+            {
+                define(parts[1], parts[2]);
+            }
+            definition = true;
+        }
+        else if (startsEnum(code))
+        {
+            enumPending = true;
+            definition = true;
+        }
+        else if (enumDepth >= 0)
+        {
+            for (String member : code.split(","))
+            {
+                int equals = member.indexOf('=');
+                if (equals > 0)
+                {
+                    define(member.substring(0, equals),
+                        member.substring(equals + 1));
+                }
+            }
+        }
+        else if ((hasWord(code, "const") || hasWord(code, "final"))
+            && assignment(code) > 0)
+        {
+            int equals = assignment(code);
+            String[] words = code.substring(0, equals).trim()
+                .split("[ \t\f*\\[\\]]+");
+            define(words[words.length - 1], code.substring(equals + 1));
+            definition = true;
+            initializer = true;
+        }
+
+        for (int i = 0; i < code.length(); i++)
+        {
+            char c = code.charAt(i);
+            if (c == '{')
+            {
+                if (enumPending)
+                {
+                    enumPending = false;
+                    enumDepth = depth;
+                }
+                depth++;
+            }
+            else if (c == '}' && depth > 0 && --depth == enumDepth)
+            {
+                enumDepth = -1;
+            }
+        }
+        if (initializer && code.endsWith(";"))
+        {
+            initializer = false;
+        }
+        if (definition)
+        {
+            definitions.set(line);
+        }
+    }
+
+    /**
+     * @param line a line number
+     * @return whether the line defines a constant or is part of an enum
+     */
+    public boolean isDefinition(int line)
+    {
+        return definitions.get(line);
+    }
+
+    /**
+     * @param literal a number
+     * @return the constant with that value, or null if there is none
+     */
+    public String nameFor(String literal)
+    {
+        return names.get(literal);
+    }
+
+    /**
+     * Whether a number is the size in an array declaration, such as
+     * "int buffer[" or "new double[", given the text before it. An index
+     * after a statement keyword, as in "return table[", is not a size.
+     *
+     * @param before the line up to the number
+     */
+    public static boolean isDimension(String before)
+    {
+        String text = before.trim();
+        if (!text.endsWith("["))
+        {
+            return false;
+        }
+        text = text.substring(0, text.length() - 1).trim();
+        String[] words = text.split("[^A-Za-z0-9_]+");
+        if (words.length >= 2 && words[words.length - 2].equals("new"))
+        {
+            return true;
+        }
+        return text.indexOf('=') < 0 && text.indexOf('(') < 0
+            && text.indexOf('[') < 0 && words.length >= 2
+            && !words[words.length - 2].isEmpty()
+            && !STATEMENT_WORDS.contains(words[words.length - 2]);
+    }
+
+    private void define(String name, String value)
+    {
+        String literal = value.trim();
+        if (literal.endsWith(";"))
+        {
+            literal = literal.substring(0, literal.length() - 1).trim();
+        }
+        if (!literal.isEmpty() && Character.isDigit(literal.charAt(0)))
+        {
+            names.putIfAbsent(literal, name.trim());
+        }
+    }
+
+    /**
+     * @return the position of the first '=' that is not part of ==, <=,
+     *         >= or !=, or -1
+     */
+    private static int assignment(String code)
+    {
+        for (int i = 0; i < code.length(); i++)
+        {
+            if (code.charAt(i) == '=')
+            {
+                boolean next = i + 1 < code.length()
+                    && code.charAt(i + 1) == '=';
+                boolean previous = i > 0 && "=<>!".indexOf(
+                    code.charAt(i - 1)) >= 0;
+                if (!next && !previous)
+                {
+                    return i;
+                }
+                i++;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @return whether the line starts the definition of an enum, as
+     *         opposed to naming an enum type in a declaration such as
+     *         "enum color c = RED;" or "void f(enum state s);"
+     */
+    private static boolean startsEnum(String code)
+    {
+        int at = wordAt(code, "enum");
+        return at >= 0 && ENUM_HEAD.matcher(
+            code.substring(at + "enum".length())).matches();
+    }
+
+    private static boolean hasWord(String code, String word)
+    {
+        return wordAt(code, word) >= 0;
+    }
+
+    /**
+     * @return where word first occurs as a whole word in code, or -1
+     */
+    private static int wordAt(String code, String word)
+    {
+        int at = code.indexOf(word);
+        while (at >= 0)
+        {
+            int end = at + word.length();
+            if ((at == 0 || !Character.isJavaIdentifierPart(
+                code.charAt(at - 1))) && (end == code.length()
+                || !Character.isJavaIdentifierPart(code.charAt(end))))
+            {
+                return at;
+            }
+            at = code.indexOf(word, end);
+        }
+        return -1;
+    }
+}
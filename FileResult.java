@@ -0,0 +1,72 @@
+
+import java.util.List;
+
+/**
+ * The outcome of analyzing one file of a batch run: either its findings
+ * or the reason it could not be analyzed. Files that Triage skipped or
+ * cut down to line length checks carry its verdict.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class FileResult
+{
+    public final int index;      // position of the file in the batch
+    public final String path;
+    public final List<Scanner.Token> tokens;
+    public final String failure; // null unless analysis failed
+    public final Triage triage;  // null if analyzed in full
+    public final List<FunctionMetrics> functions; // null unless wanted
+    public final int lines;      // lines of the source, 0 if unknown
+
+    public FileResult (int index, String path, List<Scanner.Token> tokens,
+        String failure)
+    {
+        this(index, path, tokens, failure, null);
+    }
+
+    public FileResult (int index, String path, List<Scanner.Token> tokens,
+        String failure, Triage triage)
+    {
+        this(index, path, tokens, failure, triage, null, 0);
+    }
+
+    public FileResult (int index, String path, List<Scanner.Token> tokens,
+        String failure, Triage triage, List<FunctionMetrics> functions,
+        int lines)
+    {
+        this.index = index;
+        this.path = path;
+        this.tokens = tokens;
+        this.failure = failure;
+        this.triage = triage;
+        this.functions = functions;
+        this.lines = lines;
+    }
+
+    /**
+     * Creates the result for a file that could not be analyzed.
+     *
+     * @param index position of the file in the batch
+     * @param path path of the file
+     * @param failure why the file could not be analyzed
+     * @return a result with no findings
+     */
+    public static FileResult failed(int index, String path, String failure)
+    {
+        return new FileResult(index, path, List.of(), failure);
+    }
+
+    /**
+     * Creates the result for a file that Triage skipped.
+     *
+     * @param index position of the file in the batch
+     * @param path path of the file
+     * @param triage why the file was skipped
+     * @return a result with no findings
+     */
+    public static FileResult skipped(int index, String path, Triage triage)
+    {
+        return new FileResult(index, path, List.of(), null, triage);
+    }
+}
@@ -0,0 +1,115 @@
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileReader;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Remembers how many findings each file had the last time it was
+ * analyzed, so that later runs can look at the worst files first.
+ *
+ * The cache is a text file with one "count path" line per file, keyed by
+ * absolute path. Files that were not analyzed in a run keep their old
+ * counts.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class FindingCache implements ResultSink
+{
+    private final File file;
+    private final Map<String, Integer> counts = new ConcurrentHashMap<>();
+
+    private FindingCache (File file)
+    {
+        this.file = file;
+    }
+
+    /**
+     * Loads a cache, or starts an empty one if the file does not exist.
+     *
+     * @param file the cache file
+     * @return the cache
+     */
+    public static FindingCache load(File file) throws IOException
+    {
+        FindingCache cache = new FindingCache(file);
+        if (!file.exists())
+        {
+            return cache;
+        }
+        try (BufferedReader reader = new BufferedReader(new FileReader(file)))
+        {
+            String line;
+            while ((line = reader.readLine()) != null)
+            {
+                String[] parts = line.split(" ", 2);
+                if (parts.length == 2)
+                {
+                    cache.counts.put(parts[1], Integer.parseInt(parts[0]));
+                }
+            }
+        }
+        catch (NumberFormatException e)
+        {
+            throw new IOException("Malformed finding cache " + file, e);
+        }
+        return cache;
+    }
+
+    /**
+     * The key of a file in the cache.
+     *
+     * @param file any file
+     * @return its absolute, normalized path
+     */
+    public static String key(File file)
+    {
+        return file.getAbsoluteFile().toPath().normalize().toString();
+    }
+
+    /**
+     * @param file any file
+     * @return how many findings the file had when last analyzed, or 0
+     */
+    public int findings(File file)
+    {
+        return counts.getOrDefault(key(file), 0);
+    }
+
+    /**
+     * Records the findings of a file that was analyzed in full.
+     *
+     * @param result the result of one file of the batch
+     */
+    public void accept(FileResult result)
+    {
+        if (result.failure == null && result.triage == null)
+        {
+            counts.put(key(new File(result.path)), result.tokens.size());
+        }
+    }
+
+    /**
+     * Writes the cache back, replacing the old file in one step.
+     */
+    public void save() throws IOException
+    {
+        File temporary = new File(file.getPath() + ".tmp");
+        try (PrintWriter writer = new PrintWriter(temporary))
+        {
+            for (Map.Entry<String, Integer> entry : counts.entrySet())
+            {
+                writer.println(entry.getValue() + " " + entry.getKey());
+            }
+        }
+        Files.move(temporary.toPath(), file.toPath(),
+            StandardCopyOption.REPLACE_EXISTING,
+            StandardCopyOption.ATOMIC_MOVE);
+    }
+}
@@ -0,0 +1,172 @@
+
+import jdk.jfr.Category;
+import jdk.jfr.Event;
+import jdk.jfr.Label;
+import jdk.jfr.Name;
+import jdk.jfr.StackTrace;
+
+/**
+ * Java Flight Recorder events for the analysis of a file, each of its six
+ * passes and each match of an expensive rule, so that a recording of a
+ * slow batch shows which files, passes and rules the time went to.
+ *
+ * Record with e.g.
+ *     java -XX:StartFlightRecording:filename=run.jfr BatchAnalyzer src
+ * When no recording is running, fileStarted returns null and the
+ * Scanner is not observed at all.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class FlightEvents implements ScanObserver
+{
+    @Name("nelson.FileAnalysis")
+    @Label("File Analysis")
+    @Category("Nelson Style Checker")
+    @StackTrace(false)
+    static class FileEvent extends Event
+    {
+        @Label("Path")
+        String path;
+
+        @Label("Characters")
+        long chars;
+
+        @Label("Findings")
+        int findings;
+    }
+
+    @Name("nelson.Pass")
+    @Label("Scanner Pass")
+    @Category("Nelson Style Checker")
+    @StackTrace(false)
+    static class PassEvent extends Event
+    {
+        @Label("Path")
+        String path;
+
+        @Label("Pass")
+        int pass;
+
+        @Label("Characters")
+        long chars;
+
+        @Label("Rule Matches")
+        int matches;
+
+        @Label("Pushed Back Characters")
+        int pushback;
+
+        @Label("Findings")
+        int findings;
+    }
+
+    @Name("nelson.Rule")
+    @Label("Rule Match")
+    @Category("Nelson Style Checker")
+    @StackTrace(false)
+    static class RuleEvent extends Event
+    {
+        @Label("Path")
+        String path;
+
+        @Label("Rule")
+        String rule;
+
+        @Label("Line")
+        int line;
+
+        @Label("Matched Characters")
+        int length;
+
+        @Label("Finding")
+        String finding; // null if the match was fine
+    }
+
+    private final String path;
+    private final long chars;
+    private final FileEvent file = new FileEvent();
+    private PassEvent pass = null;
+    private RuleEvent rule = null;
+    private int matches = 0;
+
+    private FlightEvents (String path, long chars)
+    {
+        this.path = path;
+        this.chars = chars;
+        file.path = path;
+        file.chars = chars;
+        file.begin();
+    }
+
+    /**
+     * Starts the event of one file.
+     *
+     * @param path the file, as reported
+     * @param chars its length in characters (a file's size in bytes
+     *        depends on its encoding, which the Scanner never sees)
+     * @return the observer of its Scanner, or null if nothing is recording
+     */
+    public static FlightEvents fileStarted(String path, long chars)
+    {
+        if (!new FileEvent().isEnabled())
+        {
+            return null;
+        }
+        return new FlightEvents(path, chars);
+    }
+
+    /**
+     * Ends and commits the event of the file.
+     *
+     * @param findings findings of the whole file
+     */
+    public void fileFinished(int findings)
+    {
+        file.findings = findings;
+        file.commit();
+    }
+
+    public void passStarted(int number)
+    {
+        pass = new PassEvent();
+        pass.path = path;
+        pass.pass = number;
+        pass.chars = chars;
+        matches = 0;
+        pass.begin();
+    }
+
+    public void passFinished(int number, int findings, int pushback)
+    {
+        pass.end();
+        pass.matches = matches;
+        pass.pushback = pushback;
+        pass.findings = findings;
+        pass.commit();
+        pass = null;
+    }
+
+    public void ruleStarted()
+    {
+        rule = new RuleEvent();
+        rule.begin();
+    }
+
+    public void ruleFinished(String name, int line, int length,
+        Scanner.Token token)
+    {
+        rule.end();
+        matches++;
+        if (rule.shouldCommit())
+        {
+            rule.path = path;
+            rule.rule = name;
+            rule.line = line;
+            rule.length = length;
+            rule.finding = token.error.equals("") ? null : token.error;
+            rule.commit();
+        }
+        rule = null;
+    }
+}
@@ -0,0 +1,261 @@
+
+/**
+ * The three parts of a for loop header, "for (init; condition; step)",
+ * split once so that the loop rules of the Scanner can look at them
+ * without matching the line again.
+ *
+ * The loop variable is the variable the init part assigns, or, failing
+ * that, the one the step part changes.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ForHeader
+{
+    public final String init;
+    public final String condition;
+    public final String step;
+    public final String initVariable; // null if init assigns nothing
+    public final String stepVariable; // null if step changes nothing
+    public final String rest;         // whatever follows the ')'
+
+    private ForHeader (String init, String condition, String step,
+        String rest)
+    {
+        this.init = init;
+        this.condition = condition;
+        this.step = step;
+        this.rest = rest;
+        this.initVariable = assigned(init);
+        this.stepVariable = assigned(step);
+    }
+
+    /**
+     * Splits a line that starts with a for loop header.
+     *
+     * @param code a line of code, without its indentation or comment
+     * @return the header, or null if the line does not start with one
+     *         (or starts with a for-each header)
+     */
+    public static ForHeader parse(String code)
+    {
+        int i = 3;
+        if (!code.startsWith("for") || code.length() <= i
+            || Character.isJavaIdentifierPart(code.charAt(i)))
+        {
+            return null;
+        }
+        while (i < code.length() && Character.isWhitespace(code.charAt(i)))
+        {
+            i++;
+        }
+        if (i == code.length() || code.charAt(i) != '(')
+        {
+            return null;
+        }
+        int open = i;
+        int[] semicolons = new int[2];
+        int found = 0;
+        int depth = 0;
+        for (i = open; i < code.length(); i++)
+        {
+            char c = code.charAt(i);
+            if (c == '"' || c == '\'')
+            {
+                i = skipLiteral(code, i);
+            }
+            else if (c == '(')
+            {
+                depth++;
+            }
+            else if (c == ')' && --depth == 0)
+            {
+                break;
+            }
+            else if (c == ';' && depth == 1)
+            {
+                if (found == 2)
+                {
+                    return null;
+                }
+                semicolons[found++] = i;
+            }
+        }
+        if (i == code.length() || found != 2)
+        {
+            return null;
+        }
+        return new ForHeader(code.substring(open + 1, semicolons[0]).trim(),
+            code.substring(semicolons[0] + 1, semicolons[1]).trim(),
+            code.substring(semicolons[1] + 1, i).trim(),
+            code.substring(i + 1).trim());
+    }
+
+    /**
+     * Checks that the loop counts: that all three parts are there, that
+     * the step changes a variable, that the condition tests it and that
+     * the init starts it.
+     *
+     * @return what makes the loop a while loop in disguise, or null
+     */
+    public String whileLoopProblem()
+    {
+        if (init.isEmpty() || condition.isEmpty() || step.isEmpty())
+        {
+            return "its " + (init.isEmpty() ? "init"
+                : condition.isEmpty() ? "condition" : "step")
+                + " is empty";
+        }
+        if (stepVariable == null)
+        {
+            return "its step does not change a variable";
+        }
+        if (!conditionMentions(stepVariable))
+        {
+            return "its condition does not test " + stepVariable;
+        }
+        if (initVariable != null && !initVariable.equals(stepVariable))
+        {
+            return "it starts " + initVariable + " but counts "
+                + stepVariable;
+        }
+        return null;
+    }
+
+    /**
+     * @param name an identifier
+     * @return whether the condition mentions it
+     */
+    public boolean conditionMentions(String name)
+    {
+        return indexOfName(condition, name, 0) >= 0;
+    }
+
+    /**
+     * Finds whether a statement assigns, increments or decrements the
+     * given variable, e.g. "i = 0", "i += 2", "i++" or "--i".
+     *
+     * @param code a line of code
+     * @param name an identifier
+     * @return whether the line changes that variable
+     */
+    public static boolean modifies(String code, String name)
+    {
+        int at = indexOfName(code, name, 0);
+        while (at >= 0)
+        {
+            int end = at + name.length();
+            if (isChange(code, end) || (at >= 2
+                && (code.startsWith("++", at - 2)
+                || code.startsWith("--", at - 2))))
+            {
+                return true;
+            }
+            at = indexOfName(code, name, end);
+        }
+        return false;
+    }
+
+    /**
+     * The variable assigned or changed by the first statement of an init
+     * or step part: the identifier right before its assignment operator
+     * or next to its ++ or --.
+     */
+    private static String assigned(String part)
+    {
+        int start = 0;
+        while (start < part.length())
+        {
+            while (start < part.length()
+                && !Character.isJavaIdentifierStart(part.charAt(start)))
+            {
+                start++;
+            }
+            int end = start;
+            while (end < part.length()
+                && Character.isJavaIdentifierPart(part.charAt(end)))
+            {
+                end++;
+            }
+            if (end > start && (isChange(part, end)
+                || (start >= 2 && (part.startsWith("++", start - 2)
+                || part.startsWith("--", start - 2)))))
+            {
+                return part.substring(start, end);
+            }
+            start = end;
+        }
+        return null;
+    }
+
+    /**
+     * Whether what follows position at, past any spaces, is an assignment
+     * (but not a comparison), ++ or --.
+     */
+    private static boolean isChange(String code, int at)
+    {
+        while (at < code.length() && code.charAt(at) == ' ')
+        {
+            at++;
+        }
+        if (code.startsWith("++", at) || code.startsWith("--", at))
+        {
+            return true;
+        }
+        if (code.startsWith("<<=", at) || code.startsWith(">>=", at))
+        {
+            return true;
+        }
+        if (at + 1 < code.length() && code.charAt(at + 1) == '='
+            && "+-*/%&|^".indexOf(code.charAt(at)) >= 0)
+        {
+            return true;
+        }
+        return at < code.length() && code.charAt(at) == '='
+            && !code.startsWith("==", at);
+    }
+
+    /**
+     * Finds a whole identifier outside of string and character literals
+     * that is not a member of something else (after "." or "->").
+     *
+     * @return its position, or -1
+     */
+    private static int indexOfName(String code, String name, int from)
+    {
+        for (int i = from; i < code.length(); i++)
+        {
+            char c = code.charAt(i);
+            if (c == '"' || c == '\'')
+            {
+                i = skipLiteral(code, i);
+            }
+            else if (code.startsWith(name, i)
+                && (i == 0 || (!Character.isJavaIdentifierPart(
+                    code.charAt(i - 1)) && code.charAt(i - 1) != '.'
+                    && !code.startsWith("->", i - 2)))
+                && (i + name.length() == code.length()
+                || !Character.isJavaIdentifierPart(
+                    code.charAt(i + name.length()))))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @return the position of the quote that ends the literal starting at
+     *         start, or the end of the line
+     */
+    private static int skipLiteral(String code, int start)
+    {
+        char quote = code.charAt(start);
+        int i = start + 1;
+        while (i < code.length() && code.charAt(i) != quote)
+        {
+            i += code.charAt(i) == '\\' ? 2 : 1;
+        }
+        return Math.min(i, code.length() - 1);
+    }
+}
@@ -0,0 +1,28 @@
+
+/**
+ * Size and complexity of one function or method, counted by the Scanner
+ * in PASS6 while it follows the function's blocks for rules 16 and 17.
+ *
+ * The complexity is an estimate of the cyclomatic complexity: one plus
+ * the number of if, else if, for, while and switch blocks. PASS6 does not
+ * see single-statement branches, case labels or && and ||.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class FunctionMetrics
+{
+    public final String name;
+    public final int line;     // line of the header
+    public int length = 0;     // lines from the header to the close brace
+    public int maxDepth = 0;   // deepest nesting of blocks in the body
+    public int returns = 0;
+    public int breaks = 0;
+    public int complexity = 1;
+
+    public FunctionMetrics (String name, int line)
+    {
+        this.name = name;
+        this.line = line;
+    }
+}
@@ -0,0 +1,238 @@
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.Writer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Random;
+
+/**
+ * Measures the latency a developer feels, rather than throughput: the
+ * time from asking for the diagnostics of one file until all of them are
+ * known, as p50, p95 and p99 over many runs, for
+ *
+ *   cold    a fresh JVM per run, as a commit hook or a save in an editor
+ *           without a server starts it, timed from launch to exit,
+ *   warm    a JVM that has already analyzed the file many times, as an
+ *           editor's analysis server would be,
+ *   edits   the warm JVM analyzing a large file again after each of a
+ *           series of small edits at random lines.
+ *
+ * The cold and warm runs cover files from 1 KB to 1 MB made by
+ * BenchmarkCorpus. Every run builds a new Scanner: its state between
+ * passes belongs to one file, and yyreset does not clear it.
+ *
+ * Usage: java LatencyBenchmark [--runs N] [--cold-runs N] [--edits N]
+ *            [--seed FILE] [--jvm OPTION]...
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class LatencyBenchmark
+{
+    private static final String CHILD = "--child";
+    private static final int[] SIZES = {1 << 10, 10 << 10, 100 << 10, 1 << 20};
+    private static final int EDITED_SIZE = 1 << 20;
+    private static final int WARMUP_RUNS = 10;
+    private static final double[] PERCENTILES = {0.50, 0.95, 0.99};
+
+    /**
+     * Runs the benchmark, or one cold run if started with --child.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args)
+        throws IOException, InterruptedException
+    {
+        if (args.length == 2 && args[0].equals(CHILD))
+        {
+            String source = Analyzer.readSource(new File(args[1]));
+            System.out.println(Analyzer.analyze(source).size());
+            return;
+        }
+
+        int runs = 200;
+        int coldRuns = 20;
+        int edits = 100;
+        String seed = BenchmarkCorpus.DEFAULT_SEED;
+        List<String> jvmOptions = new ArrayList<>();
+        boolean usage = false;
+        try
+        {
+            for (int i = 0; i < args.length; i++)
+            {
+                switch (args[i])
+                {
+                    case "--runs":
+                        runs = Integer.parseInt(args[++i]);
+                        break;
+                    case "--cold-runs":
+                        coldRuns = Integer.parseInt(args[++i]);
+                        break;
+                    case "--edits":
+                        edits = Integer.parseInt(args[++i]);
+                        break;
+                    case "--seed":
+                        seed = args[++i];
+                        break;
+                    case "--jvm":
+                        jvmOptions.add(args[++i]);
+                        break;
+                    default:
+                        usage = true;
+                        break;
+                }
+            }
+        }
+        catch (ArrayIndexOutOfBoundsException | NumberFormatException e)
+        {
+            usage = true;
+        }
+        if (usage || runs < 1 || coldRuns < 1 || edits < 1)
+        {
+            System.out.println("Usage: java LatencyBenchmark [--runs N]"
+                + " [--cold-runs N] [--edits N] [--seed FILE]"
+                + " [--jvm OPTION]...");
+            return;
+        }
+
+        BenchmarkCorpus corpus = new BenchmarkCorpus(new File(seed));
+        System.out.printf("%-6s %10s %6s %10s %10s %10s\n", "mode", "size",
+            "runs", "p50 ms", "p95 ms", "p99 ms");
+        for (int size : SIZES)
+        {
+            File file = File.createTempFile("latency", ".c");
+            file.deleteOnExit();
+            try (Writer out = new FileWriter(file))
+            {
+                out.write(corpus.source(size));
+            }
+            print("cold", size, cold(file, coldRuns, jvmOptions));
+        }
+        for (int size : SIZES)
+        {
+            print("warm", size, warm(corpus.source(size), runs));
+        }
+        print("edits", EDITED_SIZE, edits(corpus.source(EDITED_SIZE), edits));
+    }
+
+    /**
+     * @return the milliseconds of each run, from launching a JVM that
+     *         analyzes the file until it has exited
+     */
+    private static double[] cold(File file, int runs, List<String> jvmOptions)
+        throws IOException, InterruptedException
+    {
+        List<String> command = new ArrayList<>();
+        command.add(System.getProperty("java.home") + File.separator + "bin"
+            + File.separator + "java");
+        command.addAll(jvmOptions);
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add("LatencyBenchmark");
+        command.add(CHILD);
+        command.add(file.getPath());
+
+        double[] millis = new double[runs];
+        for (int run = 0; run < runs; run++)
+        {
+            long start = System.nanoTime();
+            Process process = new ProcessBuilder(command)
+                .redirectError(ProcessBuilder.Redirect.INHERIT)
+                .start();
+            String line;
+            try (BufferedReader reader = new BufferedReader(
+                new InputStreamReader(process.getInputStream())))
+            {
+                line = reader.readLine();
+            }
+            if (process.waitFor() != 0 || line == null)
+            {
+                throw new IOException("Cold run " + (run + 1) + " failed");
+            }
+            millis[run] = (System.nanoTime() - start) / 1e6;
+        }
+        return millis;
+    }
+
+    /**
+     * @return the milliseconds of each analysis of the source, after
+     *         some that are not counted
+     */
+    private static double[] warm(String source, int runs) throws IOException
+    {
+        for (int run = 0; run < WARMUP_RUNS; run++)
+        {
+            Analyzer.analyze(source);
+        }
+        double[] millis = new double[runs];
+        for (int run = 0; run < runs; run++)
+        {
+            long start = System.nanoTime();
+            Analyzer.analyze(source);
+            millis[run] = (System.nanoTime() - start) / 1e6;
+        }
+        return millis;
+    }
+
+    /**
+     * Edits the source one small change at a time, alternately changing
+     * a number and inserting a statement at a random line, and analyzes
+     * the whole text again after each edit.
+     *
+     * @return the milliseconds of each analysis after an edit
+     */
+    private static double[] edits(String source, int edits) throws IOException
+    {
+        warm(source, WARMUP_RUNS);
+        Random random = new Random(edits);
+        StringBuilder text = new StringBuilder(source);
+        double[] millis = new double[edits];
+        for (int edit = 0; edit < edits; edit++)
+        {
+            int at = text.indexOf("\n", random.nextInt(text.length())) + 1;
+            if (edit % 2 == 0)
+            {
+                text.insert(at, "    count = count + 1;\n");
+            }
+            else
+            {
+                int digit = at;
+                while (digit < text.length() && text.charAt(digit) != '\n'
+                    && !Character.isDigit(text.charAt(digit)))
+                {
+                    digit++;
+                }
+                if (digit < text.length() && text.charAt(digit) != '\n')
+                {
+                    text.setCharAt(digit, (char) ('0' + random.nextInt(10)));
+                }
+                else
+                {
+                    text.insert(at, "\n");
+                }
+            }
+            String edited = text.toString();
+            long start = System.nanoTime();
+            Analyzer.analyze(edited);
+            millis[edit] = (System.nanoTime() - start) / 1e6;
+        }
+        return millis;
+    }
+
+    private static void print(String mode, int size, double[] millis)
+    {
+        Arrays.sort(millis);
+        System.out.printf("%-6s %10d %6d", mode, size, millis.length);
+        for (double p : PERCENTILES)
+        {
+            int rank = (int) Math.ceil(p * millis.length) - 1;
+            System.out.printf(" %10.2f", millis[Math.max(0, rank)]);
+        }
+        System.out.println();
+    }
+}
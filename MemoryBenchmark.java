@@ -0,0 +1,268 @@
+
+import java.io.File;
+import java.io.FileReader;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.Reader;
+import java.io.Writer;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+import java.lang.management.MemoryType;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Properties;
+
+/**
+ * Measures the memory profile of the analyzer on inputs from 1 KB to
+ * 100 MB made by BenchmarkCorpus: for each size it prints
+ *
+ *   alloc/MB    bytes allocated per MB of input,
+ *   alloc/line  bytes allocated per line of input,
+ *   peak MB     the peak heap during the run (the sum of the peaks of
+ *               the heap pools, so a little above the true peak; it
+ *               includes the input text itself),
+ *   GCs         collections during the run, and the time they took.
+ *
+ * Allocation is counted for the analyzing thread only, after the JIT has
+ * been warmed up on smaller inputs. From 1 MB up the fixed costs (the
+ * Scanner's buffer, its tables, the JIT) no longer matter, and the bytes
+ * per line there are the steady-state allocation rate. --record saves
+ * the highest of them, plus some headroom, as a budget; --check fails
+ * (with exit status 1) if any of them is above a recorded budget, so a
+ * change that makes the actions allocate more per line is caught. Both
+ * use MemoryBenchmark.properties, next to this file, unless they are
+ * given another file. No budget is checked in yet: one is recorded with
+ * "java -Xmx2g MemoryBenchmark --record" on the reference machine, and
+ * until then --check stops (with exit status 2) before measuring.
+ *
+ * The largest inputs need a large heap, e.g. -Xmx2g.
+ *
+ * Usage: java MemoryBenchmark [--max-size BYTES] [--seed FILE]
+ *            [--record [FILE] | --check [FILE]]
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class MemoryBenchmark
+{
+    private static final int[] SIZES = {
+        1 << 10, 10 << 10, 100 << 10, 1 << 20, 10 << 20, 100 << 20};
+    private static final int STEADY_SIZE = 1 << 20;
+    private static final int WARMUP_SIZE = 100 << 10;
+    private static final int WARMUP_RUNS = 20;
+    private static final double HEADROOM = 1.10;
+    private static final String BUDGET_KEY = "allocated.bytes.per.line";
+    private static final String DEFAULT_BUDGET = "MemoryBenchmark.properties";
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args) throws IOException
+    {
+        int maxSize = SIZES[SIZES.length - 1];
+        String seed = BenchmarkCorpus.DEFAULT_SEED;
+        String record = null;
+        String check = null;
+        boolean usage = false;
+        try
+        {
+            for (int i = 0; i < args.length; i++)
+            {
+                switch (args[i])
+                {
+                    case "--max-size":
+                        maxSize = Integer.parseInt(args[++i]);
+                        break;
+                    case "--seed":
+                        seed = args[++i];
+                        break;
+                    case "--record":
+                        record = hasValue(args, i) ? args[++i]
+                            : DEFAULT_BUDGET;
+                        break;
+                    case "--check":
+                        check = hasValue(args, i) ? args[++i]
+                            : DEFAULT_BUDGET;
+                        break;
+                    default:
+                        usage = true;
+                        break;
+                }
+            }
+        }
+        catch (ArrayIndexOutOfBoundsException | NumberFormatException e)
+        {
+            usage = true;
+        }
+        if (usage || (record != null && check != null))
+        {
+            System.out.println("Usage: java MemoryBenchmark [--max-size BYTES]"
+                + " [--seed FILE] [--record [FILE] | --check [FILE]]");
+            return;
+        }
+        long limit = check == null ? 0 : recordedBudget(check);
+        if (limit < 0)
+        {
+            System.out.println("No recorded budget in " + check + "; record"
+                + " one with java -Xmx2g MemoryBenchmark --record");
+            System.exit(2);
+        }
+        if (!(ManagementFactory.getThreadMXBean()
+            instanceof com.sun.management.ThreadMXBean))
+        {
+            System.out.println("This JVM cannot count allocated bytes");
+            System.exit(2);
+        }
+        com.sun.management.ThreadMXBean threads =
+            (com.sun.management.ThreadMXBean) ManagementFactory
+            .getThreadMXBean();
+        threads.setThreadAllocatedMemoryEnabled(true);
+        long thread = Thread.currentThread().threadId();
+
+        BenchmarkCorpus corpus = new BenchmarkCorpus(new File(seed));
+        String warmup = corpus.source(WARMUP_SIZE);
+        for (int run = 0; run < WARMUP_RUNS; run++)
+        {
+            Analyzer.analyze(warmup);
+        }
+
+        System.out.printf("%10s %10s %9s %12s %11s %9s %5s %8s\n", "size",
+            "lines", "findings", "alloc/MB", "alloc/line", "peak MB", "GCs",
+            "GC ms");
+        double steady = 0;
+        for (int size : SIZES)
+        {
+            if (size > maxSize)
+            {
+                break;
+            }
+            String source = corpus.source(size);
+            int lines = Analyzer.lines(source);
+            List<MemoryPoolMXBean> pools = heapPools();
+            System.gc();
+            for (MemoryPoolMXBean pool : pools)
+            {
+                pool.resetPeakUsage();
+            }
+            long[] gcBefore = collections();
+            long allocatedBefore = threads.getThreadAllocatedBytes(thread);
+
+            int findings = Analyzer.analyze(source).size();
+
+            long allocated = threads.getThreadAllocatedBytes(thread)
+                - allocatedBefore;
+            long[] gcAfter = collections();
+            long peak = 0;
+            for (MemoryPoolMXBean pool : pools)
+            {
+                peak += pool.getPeakUsage().getUsed();
+            }
+            double perLine = (double) allocated / lines;
+            if (size >= STEADY_SIZE)
+            {
+                steady = Math.max(steady, perLine);
+            }
+            System.out.printf("%10d %10d %9d %12.0f %11.0f %9.1f %5d %8d\n",
+                source.length(), lines, findings,
+                allocated / (source.length() / 1048576.0), perLine,
+                peak / 1048576.0, gcAfter[0] - gcBefore[0],
+                gcAfter[1] - gcBefore[1]);
+        }
+
+        if (steady == 0)
+        {
+            if (record != null || check != null)
+            {
+                System.out.println("No input of at least " + STEADY_SIZE
+                    + " bytes was measured; there is no steady state");
+                System.exit(2);
+            }
+            return;
+        }
+        System.out.printf("steady state: %.0f bytes per line\n", steady);
+        if (record != null)
+        {
+            Properties budget = new Properties();
+            budget.setProperty(BUDGET_KEY,
+                String.valueOf(Math.round(steady * HEADROOM)));
+            try (Writer out = new FileWriter(record))
+            {
+                budget.store(out, "MemoryBenchmark budget");
+            }
+            System.out.println("Recorded a budget of "
+                + budget.getProperty(BUDGET_KEY) + " bytes per line in "
+                + record);
+        }
+        if (check != null)
+        {
+            if (steady > limit)
+            {
+                System.out.printf("FAILED: %.0f bytes per line is over the"
+                    + " budget of %d\n", steady, limit);
+                System.exit(1);
+            }
+            System.out.println("Within the budget of " + limit
+                + " bytes per line");
+        }
+    }
+
+    /**
+     * @return the budget recorded in the given file, or -1 if the file or
+     *         its budget is missing
+     */
+    private static long recordedBudget(String file) throws IOException
+    {
+        if (!new File(file).isFile())
+        {
+            return -1;
+        }
+        Properties budget = new Properties();
+        try (Reader in = new FileReader(file))
+        {
+            budget.load(in);
+        }
+        String limit = budget.getProperty(BUDGET_KEY);
+        return limit == null ? -1 : Long.parseLong(limit.trim());
+    }
+
+    /**
+     * @return whether the option at i is followed by a value rather than
+     *         by another option or the end of the arguments
+     */
+    private static boolean hasValue(String[] args, int i)
+    {
+        return i + 1 < args.length && !args[i + 1].startsWith("--");
+    }
+
+    private static List<MemoryPoolMXBean> heapPools()
+    {
+        List<MemoryPoolMXBean> pools = new ArrayList<>();
+        for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans())
+        {
+            if (pool.getType() == MemoryType.HEAP)
+            {
+                pools.add(pool);
+            }
+        }
+        return pools;
+    }
+
+    /**
+     * @return the number of collections so far and the milliseconds they
+     *         took, over all collectors
+     */
+    private static long[] collections()
+    {
+        long[] total = new long[2];
+        for (GarbageCollectorMXBean collector
+            : ManagementFactory.getGarbageCollectorMXBeans())
+        {
+            total[0] += Math.max(0, collector.getCollectionCount());
+            total[1] += Math.max(0, collector.getCollectionTime());
+        }
+        return total;
+    }
+}
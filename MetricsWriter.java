@@ -0,0 +1,113 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.PrintWriter;
+
+/**
+ * Writes the FunctionMetrics of a batch run, one line per function and
+ * one summary line per file, as CSV if the file name ends in ".csv" and
+ * as JSON Lines otherwise. Lines are written as results arrive, so the
+ * files are in no particular order.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class MetricsWriter implements ResultSink
+{
+    private final PrintWriter out;
+    private final boolean csv;
+
+    /**
+     * @param file where the metrics are written
+     */
+    public MetricsWriter (File file) throws IOException
+    {
+        this.out = new PrintWriter(file, "UTF-8");
+        this.csv = file.getName().endsWith(".csv");
+        if (csv)
+        {
+            out.println("kind,file,function,line,functions,length,"
+                + "max_depth,returns,breaks,complexity");
+        }
+    }
+
+    /**
+     * Writes the metrics of one file, if it was analyzed in full.
+     *
+     * @param result the result of one file of the batch
+     */
+    public synchronized void accept(FileResult result)
+    {
+        if (result.functions == null)
+        {
+            return;
+        }
+        FunctionMetrics total = new FunctionMetrics(null, 0);
+        total.complexity = 0;
+        for (FunctionMetrics f : result.functions)
+        {
+            write(result.path, f, -1);
+            total.length += f.length;
+            total.maxDepth = Math.max(total.maxDepth, f.maxDepth);
+            total.returns += f.returns;
+            total.breaks += f.breaks;
+            total.complexity += f.complexity;
+        }
+        write(result.path, total, result.functions.size());
+    }
+
+    /**
+     * Finishes the file.
+     */
+    public synchronized void close() throws IOException
+    {
+        out.close();
+        if (out.checkError())
+        {
+            throw new IOException("Could not write the metrics");
+        }
+    }
+
+    /**
+     * Writes the line of one function, or if functions is not negative
+     * the summary of a file, whose length, returns, breaks and complexity
+     * are sums over its functions.
+     */
+    private void write(String path, FunctionMetrics f, int functions)
+    {
+        boolean file = functions >= 0;
+        if (csv)
+        {
+            out.println((file ? "file," : "function,") + csvField(path)
+                + "," + (file ? ",," + functions
+                : csvField(f.name) + "," + f.line + ",")
+                + "," + f.length + "," + f.maxDepth + "," + f.returns + ","
+                + f.breaks + "," + f.complexity);
+            return;
+        }
+        out.println("{\"kind\":\"" + (file ? "file" : "function")
+            + "\",\"file\":" + jsonString(path)
+            + (file ? ",\"functions\":" + functions
+            : ",\"function\":" + jsonString(f.name) + ",\"line\":" + f.line)
+            + ",\"length\":" + f.length
+            + ",\"maxDepth\":" + f.maxDepth + ",\"returns\":" + f.returns
+            + ",\"breaks\":" + f.breaks + ",\"complexity\":" + f.complexity
+            + "}");
+    }
+
+    static String csvField(String value)
+    {
+        if (value.indexOf(',') < 0 && value.indexOf('"') < 0)
+        {
+            return value;
+        }
+        return "\"" + value.replace("\"", "\"\"") + "\"";
+    }
+
+    private static String jsonString(String value)
+    {
+        StringBuilder text = new StringBuilder();
+        TraceRecorder.quote(text, value);
+        return text.toString();
+    }
+}
@@ -0,0 +1,343 @@
+
+/**
+ * Finds arithmetic that mixes integer and floating-point operands, line
+ * by line, as PASS1 reads the file.
+ *
+ * Declarations of the basic numeric types are recorded in a SymbolTable
+ * whose scopes follow the braces; a header line's parameters go into the
+ * scope its brace opens. Then each +, -, *, / and % between two operands
+ * of known type (declared variables, literals and casts) is checked. The
+ * work per line is one pass over its tokens and one table probe per
+ * identifier. Operands of unknown type, such as calls, array elements,
+ * fields and pointers, are never reported.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class MixedModeChecker
+{
+    private static final String[] INTEGER_TYPES = {
+        "int", "long", "short", "char", "byte", "unsigned", "signed",
+        "size_t"};
+    private static final String[] FLOATING_TYPES = {"float", "double"};
+    private static final String ARITHMETIC = "+-*/%";
+    private static final int MAX_TOKENS = 256;
+
+    private static final byte NAME = 1;
+    private static final byte NUMBER = 2;
+    private static final byte SYMBOL = 3;
+
+    private final SymbolTable symbols = new SymbolTable();
+    private boolean headerScope = false; // parameters were declared in a
+                                         // scope opened ahead of its '{'
+
+    // the tokens of the current line
+    private final String[] tokens = new String[MAX_TOKENS];
+    private final byte[] kinds = new byte[MAX_TOKENS];
+    private int count = 0;
+
+    /**
+     * Reads one line of code.
+     *
+     * @param code the line, without its indentation or comment
+     * @return a description of the first mixed operation, or null
+     */
+    public String line(String code)
+    {
+        if (code.startsWith("}"))
+        {
+            symbols.closeScope();
+            return null;
+        }
+        if (code.startsWith("{"))
+        {
+            if (headerScope)
+            {
+                headerScope = false;
+            }
+            else
+            {
+                symbols.openScope();
+            }
+            return null;
+        }
+        if (headerScope)
+        {
+            symbols.closeScope(); // the header was not followed by '{'
+            headerScope = false;
+        }
+
+        tokenize(code);
+        if (count > 0 && tokens[count - 1].equals(")"))
+        {
+            // a function, loop or conditional header: its parameters or
+            // loop variables belong to the block that follows
+            symbols.openScope();
+            headerScope = true;
+        }
+        declare();
+        return mixedOperation();
+    }
+
+    /**
+     * Declares every variable that follows a numeric type name, e.g.
+     * "double x = 0, y[3];" or "(int count, float scale)". Pointers and
+     * arrays are declared of unknown type, hiding any outer variable of
+     * the same name, since their arithmetic is address arithmetic.
+     */
+    private void declare()
+    {
+        for (int i = 0; i < count; i++)
+        {
+            byte type = typeName(i);
+            if (type == SymbolTable.UNKNOWN
+                || (i > 0 && tokens[i - 1].equals("(") && i + 1 < count
+                && tokens[i + 1].equals(")")))
+            {
+                continue; // not a type, or a cast
+            }
+            while (i + 1 < count && typeName(i + 1) != SymbolTable.UNKNOWN)
+            {
+                i++; // "unsigned long", "long double"
+                if (typeName(i) == SymbolTable.FLOATING)
+                {
+                    type = SymbolTable.FLOATING;
+                }
+            }
+            i++;
+            while (i < count)
+            {
+                boolean pointer = false;
+                while (i < count && (tokens[i].equals("*")
+                    || tokens[i].equals("[") || tokens[i].equals("]")))
+                {
+                    pointer |= tokens[i++].equals("*");
+                }
+                if (i == count || kinds[i] != NAME
+                    || typeName(i) != SymbolTable.UNKNOWN)
+                {
+                    break;
+                }
+                pointer |= i + 1 < count && tokens[i + 1].equals("[");
+                symbols.declare(tokens[i++],
+                    pointer ? SymbolTable.UNKNOWN : type);
+                if (i < count && tokens[i].equals("("))
+                {
+                    break; // a function; its parameters come next
+                }
+                i = skipDeclarator(i);
+                if (i == count || !tokens[i].equals(","))
+                {
+                    break;
+                }
+                i++;
+            }
+            i--; // look at the token that ended the declaration again
+        }
+    }
+
+    /**
+     * Skips array dimensions and an initializer.
+     *
+     * @return the position of the ',', ';' or ')' ending the declarator,
+     *         or count
+     */
+    private int skipDeclarator(int i)
+    {
+        int depth = 0;
+        for (; i < count; i++)
+        {
+            String t = tokens[i];
+            if (t.equals("(") || t.equals("[") || t.equals("{"))
+            {
+                depth++;
+            }
+            else if (t.equals(")") || t.equals("]") || t.equals("}"))
+            {
+                if (depth-- == 0)
+                {
+                    return i;
+                }
+            }
+            else if (depth == 0 && (t.equals(",") || t.equals(";")))
+            {
+                return i;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @return the type named by token i, or UNKNOWN if it is no numeric
+     *         type
+     */
+    private byte typeName(int i)
+    {
+        if (kinds[i] != NAME)
+        {
+            return SymbolTable.UNKNOWN;
+        }
+        for (String type : FLOATING_TYPES)
+        {
+            if (tokens[i].equals(type))
+            {
+                return SymbolTable.FLOATING;
+            }
+        }
+        for (String type : INTEGER_TYPES)
+        {
+            if (tokens[i].equals(type))
+            {
+                return SymbolTable.INTEGER;
+            }
+        }
+        return SymbolTable.UNKNOWN;
+    }
+
+    /**
+     * Finds the first binary arithmetic operator whose operands are of
+     * different known types.
+     */
+    private String mixedOperation()
+    {
+        for (int i = 1; i + 1 < count; i++)
+        {
+            if (kinds[i] != SYMBOL || tokens[i].length() != 1
+                || ARITHMETIC.indexOf(tokens[i].charAt(0)) < 0)
+            {
+                continue;
+            }
+            byte left = operandBefore(i);
+            byte right = operandAfter(i + 1);
+            if (left != SymbolTable.UNKNOWN && right != SymbolTable.UNKNOWN
+                && left != right)
+            {
+                return "Mixed-mode arithmetic: integer and floating-point"
+                    + " operands of " + tokens[i];
+            }
+        }
+        return null;
+    }
+
+    private byte operandBefore(int operator)
+    {
+        int i = operator - 1;
+        if (i > 0 && (tokens[i - 1].equals(".")
+            || tokens[i - 1].equals("->")))
+        {
+            return SymbolTable.UNKNOWN; // a field
+        }
+        if (i >= 3 && kinds[i] == NAME && tokens[i - 1].equals(")")
+            && tokens[i - 3].equals("("))
+        {
+            byte cast = typeName(i - 2);
+            if (cast != SymbolTable.UNKNOWN)
+            {
+                return cast;
+            }
+        }
+        return typeOf(i);
+    }
+
+    private byte operandAfter(int i)
+    {
+        if (i + 2 < count && tokens[i].equals("(")
+            && tokens[i + 2].equals(")")
+            && typeName(i + 1) != SymbolTable.UNKNOWN)
+        {
+            return typeName(i + 1); // a cast
+        }
+        if (i + 1 < count && (tokens[i + 1].equals("(")
+            || tokens[i + 1].equals("[") || tokens[i + 1].equals(".")
+            || tokens[i + 1].equals("->")))
+        {
+            return SymbolTable.UNKNOWN; // a call, element or field
+        }
+        return typeOf(i);
+    }
+
+    private byte typeOf(int i)
+    {
+        if (kinds[i] == NUMBER)
+        {
+            String number = tokens[i];
+            boolean hex = number.startsWith("0x") || number.startsWith("0X");
+            return !hex && (number.indexOf('.') >= 0
+                || number.indexOf('e') >= 0 || number.indexOf('E') >= 0
+                || number.endsWith("f") || number.endsWith("F"))
+                ? SymbolTable.FLOATING : SymbolTable.INTEGER;
+        }
+        if (kinds[i] == NAME)
+        {
+            return symbols.typeOf(tokens[i]);
+        }
+        return SymbolTable.UNKNOWN;
+    }
+
+    /**
+     * Splits a line into names, numbers and symbols, skipping string and
+     * character literals. Only the first tokens of very long lines are
+     * kept.
+     */
+    private void tokenize(String code)
+    {
+        count = 0;
+        int i = 0;
+        while (i < code.length() && count < tokens.length)
+        {
+            char c = code.charAt(i);
+            int start = i;
+            byte kind;
+            if (Character.isWhitespace(c))
+            {
+                i++;
+                continue;
+            }
+            if (c == '"' || c == '\'')
+            {
+                i++;
+                while (i < code.length() && code.charAt(i) != c)
+                {
+                    i += code.charAt(i) == '\\' ? 2 : 1;
+                }
+                i++;
+                continue;
+            }
+            if (Character.isJavaIdentifierStart(c))
+            {
+                while (i < code.length()
+                    && Character.isJavaIdentifierPart(code.charAt(i)))
+                {
+                    i++;
+                }
+                kind = NAME;
+            }
+            else if (Character.isDigit(c) || (c == '.'
+                && i + 1 < code.length()
+                && Character.isDigit(code.charAt(i + 1))))
+            {
+                while (i < code.length()
+                    && (Character.isLetterOrDigit(code.charAt(i))
+                    || code.charAt(i) == '.'
+                    || ((code.charAt(i) == '-' || code.charAt(i) == '+')
+                    && (code.charAt(i - 1) == 'e'
+                    || code.charAt(i - 1) == 'E'))))
+                {
+                    i++;
+                }
+                kind = NUMBER;
+            }
+            else
+            {
+                i++;
+                if (c == '-' && i < code.length() && code.charAt(i) == '>')
+                {
+                    i++;
+                }
+                kind = SYMBOL;
+            }
+            tokens[count] = code.substring(start, Math.min(i, code.length()));
+            kinds[count++] = kind;
+        }
+    }
+}
@@ -0,0 +1,333 @@
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.PrintStream;
+import java.io.UncheckedIOException;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.PriorityQueue;
+
+/**
+ * Prints the results of a batch run in file order even though they
+ * arrive in any order. A result is held back only until every file
+ * before it has been printed, so the report streams out while the run
+ * is still going.
+ *
+ * When one slow file holds back many results, their findings could fill
+ * the heap. Once more findings than the spill threshold are held back,
+ * they are written, sorted by file, to a temporary file as a run of
+ * compact binary records and dropped from memory. The report then reads
+ * the next result from whichever run holds it, which is a streaming
+ * merge of the runs since each run is read in order, front to back.
+ * Every run keeps its file open, so once there are more than MAX_RUNS
+ * of them they are merged into one.
+ * Results without findings, failures and Triage results stay in memory;
+ * they are small.
+ *
+ * Files found while the run goes on, such as the entries of archives,
+ * are added after the files known at the start, with higher indices.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class OrderedReport implements ResultSink
+{
+    // heap used by a Token and its message, roughly
+    private static final long BYTES_PER_FINDING = 200;
+    private static final FileResult SPILLED =
+        FileResult.failed(-1, "", "spilled");
+    private static final int MAX_RUNS = 16;
+
+    private final PrintStream out;
+    private FileResult[] waiting;
+    private int fileCount;
+    private final long spillThreshold; // findings held back, or 0
+    private long held = 0;             // spillable findings in memory
+    // by the index of their next result
+    private final PriorityQueue<Run> runs =
+        new PriorityQueue<>((a, b)->(a.nextIndex - b.nextIndex));
+    private int next = 0;
+    private int errorNumber = 0;
+    private int warningNumber = 0;
+    private int failureNumber = 0;
+    private int skippedNumber = 0;
+
+    /**
+     * @param out where the report is printed
+     * @param fileCount number of files known at the start of the batch
+     */
+    public OrderedReport (PrintStream out, int fileCount)
+    {
+        this(out, fileCount,
+            Runtime.getRuntime().maxMemory() / 4 / BYTES_PER_FINDING);
+    }
+
+    /**
+     * @param out where the report is printed
+     * @param fileCount number of files known at the start of the batch
+     * @param spillThreshold how many findings may be held back before
+     *        they are written to a temporary file, or 0 for no limit
+     */
+    public OrderedReport (PrintStream out, int fileCount, long spillThreshold)
+    {
+        this.out = out;
+        this.waiting = new FileResult[fileCount];
+        this.fileCount = fileCount;
+        this.spillThreshold = spillThreshold;
+    }
+
+    /**
+     * Accepts the result of one file and prints every result that is
+     * now next in order.
+     *
+     * @param result the result of one file of the batch
+     */
+    public synchronized void accept(FileResult result)
+    {
+        if (result.index >= waiting.length)
+        {
+            waiting = Arrays.copyOf(waiting,
+                Math.max(result.index + 1, 2 * waiting.length));
+        }
+        fileCount = Math.max(fileCount, result.index + 1);
+        waiting[result.index] = result;
+        held += spillable(result);
+        while (next < fileCount && waiting[next] != null)
+        {
+            if (waiting[next] == SPILLED)
+            {
+                print(readSpilled(next));
+            }
+            else
+            {
+                held -= spillable(waiting[next]);
+                print(waiting[next]);
+            }
+            waiting[next] = null;
+            next++;
+        }
+        if (spillThreshold > 0 && held > spillThreshold)
+        {
+            spill();
+        }
+    }
+
+    /**
+     * Prints the totals once every result has been accepted.
+     */
+    public synchronized void finish()
+    {
+        out.println("==============================");
+        out.printf("Analysis Complete:\n%d Files,\n%d Errors,\n%d Warnings\n",
+            fileCount, errorNumber, warningNumber);
+        if (failureNumber > 0)
+        {
+            out.printf("%d Files could not be analyzed\n", failureNumber);
+        }
+        if (skippedNumber > 0)
+        {
+            out.printf("%d Files skipped\n", skippedNumber);
+        }
+        out.flush();
+    }
+
+    /**
+     * Writes every held back result with findings to a new run.
+     */
+    private void spill()
+    {
+        try
+        {
+            File file = File.createTempFile("report", ".run");
+            file.deleteOnExit();
+            try (DataOutputStream run = new DataOutputStream(
+                new BufferedOutputStream(new FileOutputStream(file))))
+            {
+                for (int i = next; i < fileCount; i++)
+                {
+                    FileResult result = waiting[i];
+                    if (result == null || result == SPILLED
+                        || spillable(result) == 0)
+                    {
+                        continue;
+                    }
+                    write(run, i, result);
+                    held -= result.tokens.size();
+                    waiting[i] = SPILLED;
+                }
+                run.writeInt(-1);
+            }
+            runs.add(new Run(file));
+            if (runs.size() > MAX_RUNS)
+            {
+                merge();
+            }
+        }
+        catch (IOException e)
+        {
+            throw new UncheckedIOException(e);
+        }
+    }
+
+    /**
+     * Merges all runs into one, so that only one file stays open.
+     */
+    private void merge() throws IOException
+    {
+        File file = File.createTempFile("report", ".run");
+        file.deleteOnExit();
+        try (DataOutputStream out = new DataOutputStream(
+            new BufferedOutputStream(new FileOutputStream(file))))
+        {
+            while (!runs.isEmpty())
+            {
+                Run run = runs.poll();
+                write(out, run.nextIndex, run.read());
+                if (run.nextIndex >= 0)
+                {
+                    runs.add(run);
+                }
+            }
+            out.writeInt(-1);
+        }
+        runs.add(new Run(file));
+    }
+
+    /**
+     * Writes one result with findings as a record of a run.
+     */
+    private static void write(DataOutputStream run, int index,
+        FileResult result) throws IOException
+    {
+        run.writeInt(index);
+        run.writeUTF(result.path);
+        run.writeInt(result.tokens.size());
+        for (Scanner.Token t : result.tokens)
+        {
+            run.writeInt(t.line);
+            run.writeBoolean(t.sure);
+            run.writeUTF(t.error);
+        }
+    }
+
+    /**
+     * @return how many findings spilling the result would free: all of
+     *         them for a file that was analyzed in full, else none
+     */
+    private static int spillable(FileResult result)
+    {
+        return result.failure == null && result.triage == null
+            ? result.tokens.size() : 0;
+    }
+
+    /**
+     * @return the result of file index, read back from the run at whose
+     *         front it is; results are read back in order, so that is
+     *         the run whose next result comes first
+     */
+    private FileResult readSpilled(int index)
+    {
+        Run run = runs.poll();
+        if (run == null || run.nextIndex != index)
+        {
+            throw new IllegalStateException("Result " + index + " was lost");
+        }
+        try
+        {
+            FileResult result = run.read();
+            if (run.nextIndex >= 0)
+            {
+                runs.add(run);
+            }
+            return result;
+        }
+        catch (IOException e)
+        {
+            throw new UncheckedIOException(e);
+        }
+    }
+
+    private void print(FileResult result)
+    {
+        if (result.failure != null)
+        {
+            failureNumber++;
+            out.println("==============================");
+            out.println(result.path);
+            out.println("Could not analyze: " + result.failure);
+            return;
+        }
+        if (result.triage != null && result.triage.skip)
+        {
+            skippedNumber++;
+            out.println("Skipped " + result.path + ": "
+                + result.triage.reason);
+            return;
+        }
+        if (result.tokens.isEmpty())
+        {
+            return;
+        }
+        out.println("==============================");
+        out.println(result.path);
+        if (result.triage != null)
+        {
+            out.println("(" + result.triage + ")");
+        }
+        for (Scanner.Token t : result.tokens)
+        {
+            if (t.sure) errorNumber++; else warningNumber++;
+            out.println(t);
+        }
+    }
+
+    /**
+     * A temporary file of spilled results, sorted by file index, and the
+     * index of the next one.
+     */
+    private static class Run
+    {
+        private final File file;
+        private final DataInputStream in;
+        int nextIndex;
+
+        Run (File file) throws IOException
+        {
+            this.file = file;
+            this.in = new DataInputStream(new BufferedInputStream(
+                new FileInputStream(file)));
+            this.nextIndex = in.readInt();
+        }
+
+        /**
+         * Reads the next result, and deletes the file after the last.
+         */
+        FileResult read() throws IOException
+        {
+            int index = nextIndex;
+            String path = in.readUTF();
+            int count = in.readInt();
+            List<Scanner.Token> tokens = new ArrayList<>(count);
+            for (int i = 0; i < count; i++)
+            {
+                int line = in.readInt();
+                boolean sure = in.readBoolean();
+                tokens.add(new Scanner.Token(in.readUTF(), line, sure));
+            }
+            nextIndex = in.readInt();
+            if (nextIndex < 0)
+            {
+                in.close();
+                file.delete();
+            }
+            return new FileResult(index, path, tokens, null);
+        }
+    }
+}
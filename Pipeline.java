@@ -0,0 +1,317 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.BlockingQueue;
+import java.util.concurrent.LinkedBlockingQueue;
+import java.util.concurrent.Semaphore;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLongArray;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Runs a batch in this JVM as three overlapping stages:
+ *
+ * 1. a pool of virtual threads that read files ahead of the scanners,
+ *    at most PREFETCH_PER_WORKER files per worker at a time;
+ * 2. a fixed pool of platform threads that only run the Scanner;
+ * 3. a single writer (the calling thread) that prints the report, fed
+ *    through a bounded lock-free RingQueue.
+ *
+ * A scanning thread never touches the disk or stdout, so while one file
+ * is being read and another printed the CPUs keep scanning. Readers run
+ * Triage first, so a skipped file costs a single small read. If there
+ * is a TokenStream cache, each scanning thread adds the stream of a file
+ * to it after handing on the file's result, so the extra lexing and
+ * hashing stay on the bounded pool of scanners and off the readers; a
+ * file whose stream cannot be cached is still reported.
+ *
+ * Scanners can also collect the FunctionMetrics of every file. With a
+ * TraceRecorder, every stage records spans for its work on each file
+ * and the writer samples the depth of both queues. Each scanning thread
+ * also counts the time it spends analyzing, for the ScalingBenchmark,
+ * and tells a ProgressReporter which file it is on.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class Pipeline
+{
+    private static final int PREFETCH_PER_WORKER = 4;
+    private static final int READER_THREADS = 64;
+    private static final int RESULT_QUEUE_CAPACITY = 1024;
+    private static final long IDLE_PARK_NANOS = 100_000;
+    private static final long COUNTER_INTERVAL_NANOS = 1_000_000;
+
+    private final List<File> files;
+    private final int workers;
+    private final ResultSink report;
+    private final boolean triage;
+    private final TraceRecorder trace; // may be null
+    private final boolean metrics;
+    private final ProgressReporter progress; // may be null
+    private final File tokens; // TokenStream cache, or null
+
+    private final AtomicInteger nextToRead = new AtomicInteger();
+    private final AtomicInteger nextToScan = new AtomicInteger();
+    private final Semaphore prefetch;
+    private final BlockingQueue<Loaded> loaded = new LinkedBlockingQueue<>();
+    private final RingQueue<FileResult> results =
+        new RingQueue<>(RESULT_QUEUE_CAPACITY);
+    private final AtomicLongArray busy; // nanoseconds, by worker
+    private final AtomicInteger uncached = new AtomicInteger();
+
+    /**
+     * @param files the files of the batch, in report order
+     * @param workers number of scanning threads
+     * @param report receives the result of every file
+     * @param triage whether to run Triage on each file first
+     * @param trace records the timeline of the run, or null
+     * @param metrics whether to collect the metrics of every function
+     * @param progress shows the progress of the run, or null
+     * @param tokens directory of the TokenStream cache, or null
+     */
+    public Pipeline (List<File> files, int workers, ResultSink report,
+        boolean triage, TraceRecorder trace, boolean metrics,
+        ProgressReporter progress, File tokens)
+    {
+        this.files = files;
+        this.workers = workers;
+        this.report = report;
+        this.triage = triage;
+        this.trace = trace;
+        this.metrics = metrics;
+        this.progress = progress;
+        this.tokens = tokens;
+        this.prefetch = new Semaphore(workers * PREFETCH_PER_WORKER);
+        this.busy = new AtomicLongArray(workers);
+    }
+
+    /**
+     * Analyzes every file and returns once all results have reached the
+     * report.
+     */
+    public void run() throws InterruptedException
+    {
+        int readers = Math.min(READER_THREADS, files.size());
+        for (int i = 0; i < readers; i++)
+        {
+            Thread.ofVirtual().name("reader-" + i).start(this::read);
+        }
+        for (int i = 0; i < workers; i++)
+        {
+            int id = i;
+            Thread worker = new Thread(() -> scan(id), "scanner-" + i);
+            worker.setDaemon(true);
+            worker.start();
+        }
+
+        int written = 0;
+        long nextCount = 0;
+        while (written < files.size())
+        {
+            if (trace != null && trace.now() >= nextCount)
+            {
+                trace.counter("loaded files", loaded.size());
+                trace.counter("results", results.size());
+                nextCount = trace.now() + COUNTER_INTERVAL_NANOS;
+            }
+            FileResult result = results.poll();
+            if (result == null)
+            {
+                LockSupport.parkNanos(IDLE_PARK_NANOS);
+                continue;
+            }
+            long start = trace == null ? 0 : trace.now();
+            report.accept(result);
+            if (trace != null)
+            {
+                trace.span("report", result.path, start);
+            }
+            written++;
+        }
+    }
+
+    /**
+     * @return for each scanning thread, the nanoseconds it spent
+     *         analyzing files; the rest of the run it was waiting for
+     *         input, for room in the writer's queue or for the others
+     */
+    public long[] busyNanos()
+    {
+        long[] nanos = new long[workers];
+        for (int i = 0; i < workers; i++)
+        {
+            nanos[i] = busy.get(i);
+        }
+        return nanos;
+    }
+
+    /**
+     * @return how many files were analyzed without their TokenStream
+     *         being added to the cache, because it could not be written
+     */
+    public int uncachedFiles()
+    {
+        return uncached.get();
+    }
+
+    /**
+     * Reader stage: loads files in batch order while prefetch permits
+     * are available.
+     */
+    private void read()
+    {
+        int index;
+        while ((index = nextToRead.getAndIncrement()) < files.size())
+        {
+            prefetch.acquireUninterruptibly();
+            File file = files.get(index);
+            long start = trace == null ? 0 : trace.now();
+            long bytes = progress == null ? 0 : file.length();
+            try
+            {
+                Triage verdict = triage ? Triage.inspect(file) : null;
+                String source = (verdict != null && verdict.skip) ? null
+                    : Analyzer.readSource(file);
+                if (trace != null)
+                {
+                    trace.span("read", file.getPath(), start);
+                }
+                loaded.add(new Loaded(index, file, bytes, source, null,
+                    verdict));
+            }
+            catch (IOException | RuntimeException | Error e)
+            {
+                // every file must reach the scanners, or they wait forever
+                loaded.add(new Loaded(index, file, bytes, null,
+                    e.toString(), null));
+            }
+        }
+    }
+
+    /**
+     * Scanning stage: takes whichever file has been read, analyzes it
+     * and hands the result to the writer.
+     */
+    private void scan(int id)
+    {
+        try
+        {
+            while (nextToScan.getAndIncrement() < files.size())
+            {
+                long start = trace == null ? 0 : trace.now();
+                Loaded next = loaded.take();
+                if (trace != null)
+                {
+                    trace.span("wait for input", next.file.getPath(), start);
+                }
+                prefetch.release();
+                if (progress != null)
+                {
+                    progress.started(id, next.file.getPath());
+                }
+                long analyzing = System.nanoTime();
+                FileResult result = analyze(next);
+                busy.addAndGet(id, System.nanoTime() - analyzing);
+                if (progress != null)
+                {
+                    progress.finished(id, next.bytes, result.tokens.size());
+                }
+                publish(result);
+                if (tokens != null && next.source != null)
+                {
+                    cacheTokens(next);
+                }
+            }
+        }
+        catch (InterruptedException e)
+        {
+            Thread.currentThread().interrupt();
+        }
+    }
+
+    private FileResult analyze(Loaded next)
+    {
+        String path = next.file.getPath();
+        if (next.failure != null)
+        {
+            return FileResult.failed(next.index, path, next.failure);
+        }
+        if (next.triage != null && next.triage.skip)
+        {
+            return FileResult.skipped(next.index, path, next.triage);
+        }
+        try
+        {
+            if (next.triage != null)
+            {
+                return new FileResult(next.index, path,
+                    Triage.checkLineLengths(next.source), null, next.triage);
+            }
+            ArrayList<FunctionMetrics> functions =
+                metrics ? new ArrayList<>() : null;
+            List<Scanner.Token> tokens =
+                Analyzer.analyze(next.source, path, trace, functions);
+            return new FileResult(next.index, path, tokens, null, null,
+                functions, Analyzer.lines(next.source));
+        }
+        catch (IOException | RuntimeException | Error e)
+        {
+            // the Scanner throws Error when it cannot match or push back,
+            // and every file must reach the writer, or it waits forever
+            return FileResult.failed(next.index, path, e.toString());
+        }
+    }
+
+    private void cacheTokens(Loaded next)
+    {
+        long start = trace == null ? 0 : trace.now();
+        try
+        {
+            TokenStream.cached(tokens, next.source);
+        }
+        catch (IOException | RuntimeException | Error e)
+        {
+            uncached.incrementAndGet(); // the report does not need it
+        }
+        if (trace != null)
+        {
+            trace.span("cache tokens", next.file.getPath(), start);
+        }
+    }
+
+    private void publish(FileResult result)
+    {
+        while (!results.offer(result))
+        {
+            LockSupport.parkNanos(IDLE_PARK_NANOS);
+        }
+    }
+
+    /**
+     * A file whose contents have been read, or that could not be read,
+     * or that Triage decided to skip.
+     */
+    private static class Loaded
+    {
+        final int index;
+        final File file;
+        final long bytes; // its length, if there is a ProgressReporter
+        final String source;
+        final String failure;
+        final Triage triage;
+
+        Loaded (int index, File file, long bytes, String source,
+            String failure, Triage triage)
+        {
+            this.index = index;
+            this.file = file;
+            this.bytes = bytes;
+            this.source = source;
+            this.failure = failure;
+            this.triage = triage;
+        }
+    }
+}
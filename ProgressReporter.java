@@ -0,0 +1,206 @@
+
+import java.io.File;
+import java.io.PrintStream;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.atomic.AtomicLongArray;
+import java.util.concurrent.atomic.AtomicReferenceArray;
+import java.util.concurrent.atomic.LongAdder;
+
+/**
+ * Shows the progress of a long batch run on stderr: files done out of
+ * the total, MB/s, files/s, findings so far, the estimated time left and
+ * the file that has been scanning the longest. On a terminal the line is
+ * redrawn twice a second; otherwise a "progress key=value ..." line is
+ * printed every ten seconds, for build logs.
+ *
+ * The scanning threads only add to LongAdders, whose cells are striped
+ * across threads, and write their current file into their own slot, so
+ * they never wait for each other or for the display.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ProgressReporter
+{
+    private static final long TERMINAL_INTERVAL_MILLIS = 500;
+    private static final long LOG_INTERVAL_MILLIS = 10_000;
+
+    private final List<File> files;
+    private final PrintStream out;
+    private final boolean terminal;
+
+    private final LongAdder filesDone = new LongAdder();
+    private final LongAdder bytesDone = new LongAdder();
+    private final LongAdder findings = new LongAdder();
+    private final AtomicReferenceArray<String> current; // by worker
+    private final AtomicLongArray startedAt; // nanoTime, by worker
+
+    private volatile long totalBytes = -1; // unknown until the display
+                                           // has run
+    private long start;
+    private Thread display;
+
+    /**
+     * @param files the files of the batch
+     * @param workers number of scanning threads
+     */
+    public ProgressReporter (List<File> files, int workers)
+    {
+        this.files = files;
+        this.out = System.err;
+        this.terminal = System.console() != null;
+        this.current = new AtomicReferenceArray<>(workers);
+        this.startedAt = new AtomicLongArray(workers);
+    }
+
+    /**
+     * Starts the display thread.
+     */
+    public void start()
+    {
+        start = System.nanoTime();
+        display = new Thread(this::display, "progress");
+        display.setDaemon(true);
+        display.start();
+    }
+
+    /**
+     * Stops the display and prints the final counts.
+     */
+    public void finish() throws InterruptedException
+    {
+        display.interrupt();
+        display.join();
+        out.println(terminal ? "\r" + line() : "progress " + fields());
+    }
+
+    /**
+     * Called by a scanning thread before it analyzes a file.
+     *
+     * @param worker the thread's number
+     * @param path the file
+     */
+    public void started(int worker, String path)
+    {
+        startedAt.set(worker, System.nanoTime());
+        current.set(worker, path);
+    }
+
+    /**
+     * Called by a scanning thread once it has analyzed a file.
+     *
+     * @param worker the thread's number
+     * @param bytes length of the file
+     * @param found number of findings in the file
+     */
+    public void finished(int worker, long bytes, int found)
+    {
+        current.set(worker, null);
+        filesDone.increment();
+        bytesDone.add(bytes);
+        findings.add(found);
+    }
+
+    private void display()
+    {
+        long total = 0;
+        for (File file : files)
+        {
+            total += file.length(); // a stat per file, off the workers
+        }
+        totalBytes = total;
+        try
+        {
+            while (true)
+            {
+                Thread.sleep(terminal ? TERMINAL_INTERVAL_MILLIS
+                    : LOG_INTERVAL_MILLIS);
+                if (terminal)
+                {
+                    out.print("\r" + line());
+                }
+                else
+                {
+                    out.println("progress " + fields());
+                }
+                out.flush();
+            }
+        }
+        catch (InterruptedException e)
+        {
+            // finished
+        }
+    }
+
+    /**
+     * @return the terminal display, padded to clear a longer old line
+     */
+    private String line()
+    {
+        double seconds = Math.max(1e-3, (System.nanoTime() - start) / 1e9);
+        long done = filesDone.sum();
+        String slowest = slowest();
+        String text = String.format(Locale.ROOT,
+            "%d/%d files  %.1f MB/s  %.1f files/s  %d findings  ETA %s%s",
+            done, files.size(), bytesDone.sum() / 1048576.0 / seconds,
+            done / seconds, findings.sum(), eta(seconds),
+            slowest == null ? "" : "  slowest: " + slowest);
+        return String.format("%-100s", text);
+    }
+
+    /**
+     * @return the same counts as key=value pairs
+     */
+    private String fields()
+    {
+        double seconds = Math.max(1e-3, (System.nanoTime() - start) / 1e9);
+        long done = filesDone.sum();
+        String slowest = slowest();
+        return String.format(Locale.ROOT,
+            "files=%d total=%d mb_per_s=%.2f files_per_s=%.1f findings=%d"
+            + " eta=%s%s", done, files.size(),
+            bytesDone.sum() / 1048576.0 / seconds, done / seconds,
+            findings.sum(), eta(seconds),
+            slowest == null ? "" : " slowest=" + slowest);
+    }
+
+    /**
+     * @return the time left at the byte rate so far, or "?" before it
+     *         can be estimated
+     */
+    private String eta(double seconds)
+    {
+        long bytes = bytesDone.sum();
+        if (totalBytes < 0 || bytes == 0)
+        {
+            return "?";
+        }
+        long left = Math.round(Math.max(0, totalBytes - bytes)
+            * seconds / bytes);
+        return String.format("%d:%02d", left / 60, left % 60);
+    }
+
+    /**
+     * @return the file being scanned for the longest time and for how
+     *         long, or null if no file is being scanned
+     */
+    private String slowest()
+    {
+        long now = System.nanoTime();
+        String path = null;
+        long longest = -1;
+        for (int i = 0; i < current.length(); i++)
+        {
+            String file = current.get(i);
+            long elapsed = now - startedAt.get(i);
+            if (file != null && elapsed > longest)
+            {
+                path = file;
+                longest = elapsed;
+            }
+        }
+        return path == null ? null
+            : String.format(Locale.ROOT, "%s (%.1fs)", path, longest / 1e9);
+    }
+}
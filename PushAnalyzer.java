@@ -0,0 +1,159 @@
+
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.CharBuffer;
+import java.nio.charset.Charset;
+import java.nio.charset.CharsetDecoder;
+import java.nio.charset.CodingErrorAction;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Analyzes a file that arrives in chunks, such as a document in an
+ * editor or a stream in an event loop, without a thread that blocks
+ * waiting for the rest of it. The caller pushes each chunk with feed and
+ * ends the file with finish; neither ever waits for input. A file is
+ * fed either as chars or as bytes, not both.
+ *
+ * A chunk is only appended to the text received so far (bytes are
+ * decoded with the platform charset, like Analyzer.readSource, keeping a
+ * character that is split across two chunks until it is complete). The
+ * Scanner rewinds the whole file five times and most of its rules depend
+ * on what comes later (a comment closed further down, the end of a
+ * block), so it runs once, in finish. Line length only depends on the
+ * line itself, so feed reports every complete line that is too long as
+ * soon as its end arrives, and finish leaves those findings out.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class PushAnalyzer
+{
+    private final StringBuilder text = new StringBuilder();
+    private final CharsetDecoder decoder = Charset.defaultCharset()
+        .newDecoder()
+        .onMalformedInput(CodingErrorAction.REPLACE)
+        .onUnmappableCharacter(CodingErrorAction.REPLACE);
+    private ByteBuffer undecoded = ByteBuffer.allocate(0);
+    private int lineStart = 0; // where the incomplete last line starts
+    private int line = 1;      // its number
+    private boolean finished = false;
+
+    /**
+     * Adds a chunk of text.
+     *
+     * @param chunk the next chars of the file
+     * @param offset where they start in chunk
+     * @param length how many there are
+     * @return the findings that are final now
+     */
+    public List<Scanner.Token> feed(char[] chunk, int offset, int length)
+    {
+        checkOpen();
+        text.append(chunk, offset, length);
+        return completeLines();
+    }
+
+    /**
+     * Adds a chunk of bytes, all of which are consumed.
+     *
+     * @param chunk the next bytes of the file
+     * @return the findings that are final now
+     */
+    public List<Scanner.Token> feed(ByteBuffer chunk)
+    {
+        checkOpen();
+        decode(chunk, false);
+        return completeLines();
+    }
+
+    /**
+     * Ends the file and analyzes it.
+     *
+     * @return the findings that feed did not report, sorted by line
+     */
+    public List<Scanner.Token> finish() throws IOException
+    {
+        checkOpen();
+        decode(ByteBuffer.allocate(0), true);
+        finished = true;
+        List<Scanner.Token> tokens = new ArrayList<>(completeLines());
+        for (Scanner.Token t : Analyzer.analyze(text, "<input>", null, null))
+        {
+            if (Rule.of(t) != Rule.LINE_LENGTH)
+            {
+                tokens.add(t);
+            }
+        }
+        tokens.sort((a, b)->(a.line - b.line));
+        return tokens;
+    }
+
+    private void checkOpen()
+    {
+        if (finished)
+        {
+            throw new IllegalStateException("finish was already called");
+        }
+    }
+
+    /**
+     * Decodes the bytes left over from the last chunk and then the new
+     * chunk, keeping an incomplete character for next time.
+     */
+    private void decode(ByteBuffer chunk, boolean endOfInput)
+    {
+        ByteBuffer in = ByteBuffer.allocate(undecoded.remaining()
+            + chunk.remaining());
+        in.put(undecoded).put(chunk).flip();
+        CharBuffer out = CharBuffer.allocate((int) (in.remaining()
+            * (double) decoder.maxCharsPerByte()) + 2);
+        decoder.decode(in, out, endOfInput);
+        if (endOfInput)
+        {
+            decoder.flush(out);
+        }
+        out.flip();
+        text.append(out);
+        undecoded = in;
+    }
+
+    /**
+     * Checks the lines that have been completed since the last call, and
+     * at the end of the file also the last line.
+     */
+    private List<Scanner.Token> completeLines()
+    {
+        List<Scanner.Token> tokens = new ArrayList<>();
+        int i = lineStart;
+        while (true)
+        {
+            int end = text.indexOf("\n", i);
+            if (end < 0)
+            {
+                if (!finished || lineStart == text.length())
+                {
+                    return tokens;
+                }
+                end = text.length(); // the last line has no terminator
+            }
+            int length = end - lineStart;
+            if (end > lineStart && text.charAt(end - 1) == '\r')
+            {
+                length--;
+            }
+            Scanner.Token token = Triage.checkLineLength(length, line);
+            if (token != null)
+            {
+                tokens.add(token);
+            }
+            line++;
+            lineStart = end + 1;
+            i = lineStart;
+            if (lineStart > text.length())
+            {
+                return tokens;
+            }
+        }
+    }
+}
@@ -0,0 +1,358 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Checks behaviour that has gone wrong before, without a test framework:
+ * each check feeds a small input to the class concerned and compares the
+ * outcome with the expected one. Prints every check that fails and exits
+ * with status 1 if any did.
+ *
+ * Usage: java RegressionTester
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class RegressionTester
+{
+    private static int failures = 0;
+
+    /**
+     * Runs every check.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args) throws IOException
+    {
+        commentedLines();
+        pointerArithmetic();
+        enumTypedDeclarations();
+        arrayDimensions();
+        tokenLines();
+        tokenStreamFiles();
+        pushedChunks();
+        commentLines();
+        if (failures > 0)
+        {
+            System.out.println(failures + " checks failed");
+            System.exit(1);
+        }
+        System.out.println("All checks passed");
+    }
+
+    /**
+     * A line that ends in a block comment still counts as code for the
+     * loops, the scopes of the SymbolTable and the constants of PASS1.
+     */
+    private static void commentedLines() throws IOException
+    {
+        String loop = "int main(void)\n"
+            + "{\n"
+            + "   int i;\n"
+            + "   for (i = 0; i < 3; i++)\n"
+            + "   {\n"
+            + "      puts(\"x\");\n"
+            + "   } /* end for */\n"
+            + "   i = 5;\n"
+            + "   return 0;\n"
+            + "}\n";
+        check("loop closed by a brace with a comment",
+            !hasFinding(Analyzer.analyze(loop), "Loop iterator"));
+        String scopes = "void scale(void)\n"
+            + "{\n"
+            + "   double d = 1.5;\n"
+            + "} /* end scale */\n"
+            + "\n"
+            + "int next(void)\n"
+            + "{\n"
+            + "   return d + 1;\n"
+            + "}\n";
+        check("scope closed by a brace with a comment",
+            !hasFinding(Analyzer.analyze(scopes), "Mixed-mode"));
+        String constant = "#define SIZE 64 /* bytes */\n"
+            + "\n"
+            + "int scaled(int n)\n"
+            + "{\n"
+            + "   return n * 64;\n"
+            + "}\n";
+        check("#define followed by a comment",
+            hasFinding(Analyzer.analyze(constant),
+            "Potential magic number; use the constant SIZE"));
+    }
+
+    private static boolean hasFinding(List<Scanner.Token> tokens,
+        String prefix)
+    {
+        for (Scanner.Token t : tokens)
+        {
+            if (t.error.startsWith(prefix))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * A pointer or array to a numeric type takes part in address
+     * arithmetic, which mixes nothing.
+     */
+    private static void pointerArithmetic()
+    {
+        MixedModeChecker pointers = new MixedModeChecker();
+        pointers.line("double *p;");
+        check("pointer plus an integer", pointers.line("p = p + 1;") == null);
+        MixedModeChecker arrays = new MixedModeChecker();
+        arrays.line("float samples[8], *end;");
+        check("array plus an integer",
+            arrays.line("end = samples + 8;") == null);
+        MixedModeChecker values = new MixedModeChecker();
+        values.line("double d, *p;");
+        check("value beside a pointer still checked",
+            values.line("d = d + 1;") != null);
+    }
+
+    /**
+     * A variable or parameter of an enum type does not open an enum body,
+     * so the function after it is not taken for one.
+     */
+    private static void enumTypedDeclarations()
+    {
+        String[] lines = {
+            "enum color c = RED;",
+            "void paint(enum color shade);",
+            "",
+            "int twice(int x)",
+            "{",
+            "return x * 7;",
+            "x = 5;",
+            "}",
+            "enum state",
+            "{",
+            "IDLE = 4,",
+            "BUSY = 5",
+            "};"};
+        ConstantTable table = new ConstantTable();
+        for (int i = 0; i < lines.length; i++)
+        {
+            table.line(lines[i], i + 1);
+        }
+        check("function after an enum-typed variable is not an enum",
+            !table.isDefinition(5) && !table.isDefinition(6)
+            && !table.isDefinition(7));
+        check("enum definition with its brace on the next line, and no"
+            + " member taken from the function",
+            table.isDefinition(11) && "BUSY".equals(table.nameFor("5")));
+    }
+
+    /**
+     * Only a declaration gives an array its size.
+     */
+    private static void arrayDimensions()
+    {
+        check("declared size", ConstantTable.isDimension("int buffer[")
+            && ConstantTable.isDimension("new double["));
+        check("index after return",
+            !ConstantTable.isDimension("   return table["));
+        check("index after case", !ConstantTable.isDimension("case LIMITS["));
+        check("index of a dereference", !ConstantTable.isDimension("*p["));
+    }
+
+    /**
+     * Tokens keep their line numbers after an unterminated literal and
+     * after a literal continued with a backslash.
+     */
+    private static void tokenLines()
+    {
+        TokenStream stream = TokenStream.lex("char c = 'a\n"
+            + "int x;\n"
+            + "char *s = \"one \\\ntwo\";\n"
+            + "z\n");
+        int[] expected = {1, 1, 1, 1, 2, 2, 2, 3, 3, 3, 3, 3, 4, 5};
+        boolean same = stream.size() == expected.length;
+        for (int i = 0; same && i < expected.length; i++)
+        {
+            same = stream.line(i) == expected[i];
+        }
+        check("lines of tokens after literals", same);
+        check("unterminated literal stops before the newline",
+            stream.kind(3) == TokenStream.CHARACTER && stream.length(3) == 2);
+    }
+
+    /**
+     * A stream reads back the same from its file, and the cache returns
+     * the stream of a text it has seen.
+     */
+    private static void tokenStreamFiles() throws IOException
+    {
+        String text = "/* a comment */\nint main(void)\n{\n"
+            + "    return puts(\"hi\") >= 0;\n}\n";
+        TokenStream lexed = TokenStream.lex(text);
+        File directory = Files.createTempDirectory("tokens").toFile();
+        try
+        {
+            File file = new File(directory, "main.tok");
+            lexed.write(file);
+            check("stream written and mapped back",
+                sameStream(lexed, TokenStream.map(file), text.length()));
+            check("stream from the cache", sameStream(lexed,
+                TokenStream.cached(directory, text), text.length())
+                && sameStream(lexed, TokenStream.cached(directory, text),
+                text.length()));
+            File truncated = new File(directory, "truncated.tok");
+            Files.write(truncated.toPath(), Arrays.copyOf(
+                Files.readAllBytes(file.toPath()), (int) file.length() - 1));
+            boolean rejected = false;
+            try
+            {
+                TokenStream.map(truncated);
+            }
+            catch (IOException e)
+            {
+                rejected = true;
+            }
+            check("truncated stream rejected", rejected);
+        }
+        finally
+        {
+            for (File file : directory.listFiles())
+            {
+                file.delete();
+            }
+            directory.delete();
+        }
+    }
+
+    private static boolean sameStream(TokenStream a, TokenStream b,
+        int textLength)
+    {
+        if (a.size() != b.size() || a.textLength() != b.textLength())
+        {
+            return false;
+        }
+        for (int i = 0; i < a.size(); i++)
+        {
+            if (a.kind(i) != b.kind(i) || a.start(i) != b.start(i)
+                || a.length(i) != b.length(i) || a.line(i) != b.line(i))
+            {
+                return false;
+            }
+        }
+        for (int offset = 0; offset < textLength; offset++)
+        {
+            if (a.inComment(offset) != b.inComment(offset)
+                || a.inLiteral(offset) != b.inLiteral(offset))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Text pushed in chunks of any size has the same findings, on the
+     * same lines, as the whole text analyzed at once.
+     */
+    private static void pushedChunks() throws IOException
+    {
+        String text = "/* long lines */\r\n"
+            + "int x = 1;" + " ".repeat(130) + "/* end */\n"
+            + "\n"
+            + "int twice(int y)\n"
+            + "{\n"
+            + "\treturn y * 7;" + "x".repeat(140) + "\n"
+            + "}";
+        List<String> whole = describe(Analyzer.analyze(text));
+        List<String> longLines = describe(Triage.checkLineLengths(text));
+        check("long lines numbered like Triage", longLines.size() == 2
+            && longLines.equals(describe(longLines(
+            Analyzer.analyze(text)))));
+        char[] decoded = text.toCharArray();
+        byte[] encoded = text.getBytes();
+        for (int size : new int[] {1, 7, 64, text.length()})
+        {
+            PushAnalyzer chars = new PushAnalyzer();
+            PushAnalyzer bytes = new PushAnalyzer();
+            List<Scanner.Token> fromChars = new ArrayList<>();
+            List<Scanner.Token> fromBytes = new ArrayList<>();
+            for (int i = 0; i < text.length(); i += size)
+            {
+                fromChars.addAll(chars.feed(decoded, i,
+                    Math.min(size, decoded.length - i)));
+            }
+            for (int i = 0; i < encoded.length; i += size)
+            {
+                fromBytes.addAll(bytes.feed(ByteBuffer.wrap(encoded, i,
+                    Math.min(size, encoded.length - i))));
+            }
+            fromChars.addAll(chars.finish());
+            fromBytes.addAll(bytes.finish());
+            check("chars pushed " + size + " at a time",
+                describe(fromChars).equals(whole));
+            check("bytes pushed " + size + " at a time",
+                describe(fromBytes).equals(whole));
+        }
+    }
+
+    /**
+     * A single line comment on its own line is reported on that line.
+     */
+    private static void commentLines() throws IOException
+    {
+        String text = "int main(void)\n"
+            + "{\n"
+            + "   // no block comment\n"
+            + "   return 0;\n"
+            + "}\n";
+        boolean numbered = false;
+        for (Scanner.Token t : Analyzer.analyze(text))
+        {
+            if (t.error.startsWith("Single line comment on its own line"))
+            {
+                numbered = t.line == 3;
+            }
+        }
+        check("single line comment on its own line numbered", numbered);
+    }
+
+    private static List<Scanner.Token> longLines(List<Scanner.Token> tokens)
+    {
+        List<Scanner.Token> lines = new ArrayList<>();
+        for (Scanner.Token t : tokens)
+        {
+            if (Rule.of(t) == Rule.LINE_LENGTH)
+            {
+                lines.add(t);
+            }
+        }
+        return lines;
+    }
+
+    /**
+     * @return each finding as "line sure message", sorted
+     */
+    private static List<String> describe(List<Scanner.Token> tokens)
+    {
+        List<String> described = new ArrayList<>();
+        for (Scanner.Token t : tokens)
+        {
+            described.add(t.line + " " + t.sure + " " + t.error);
+        }
+        described.sort(null);
+        return described;
+    }
+
+    private static void check(String name, boolean passed)
+    {
+        if (!passed)
+        {
+            System.out.println("FAILED: " + name);
+            failures++;
+        }
+    }
+}
@@ -0,0 +1,499 @@
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.BufferedReader;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.EOFException;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.FileReader;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.PrintStream;
+import java.io.PrintWriter;
+import java.text.SimpleDateFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+
+/**
+ * An append-only history of the findings of batch runs, so that style
+ * debt can be followed over time and the findings that are new since an
+ * older run can be listed without analyzing the old version again.
+ *
+ * A history FILE is three files:
+ *
+ *   FILE        the findings of every run, each run's sorted by value,
+ *               8 bytes per finding;
+ *   FILE.idx    40 bytes per run: its time, the offset of its findings,
+ *               how many there are, and how many are errors and
+ *               warnings, so that trends are read from this file alone;
+ *   FILE.names  the path of every file ever seen, one per line; a file's
+ *               id is its line number.
+ *
+ * A path is stored relative to the top level of the git repository the
+ * file is in (the nearest directory above it with a .git), and with '/'
+ * between its parts, so that runs in two clones of a repository, or in
+ * one clone that has moved, compare file by file. A file outside of any
+ * repository is stored by its absolute path.
+ *
+ * A finding is stored as one long: the file id, a 24-bit fingerprint and
+ * the rule number and severity. The fingerprint hashes the message and
+ * how many findings with the same message came before it in the file,
+ * so unlike the line number it survives edits elsewhere in the file.
+ * A file that could not be analyzed, or that Triage skipped or cut down,
+ * is recorded with one marker in place of a finding (rule number 127).
+ * Two runs are compared by merging their sorted findings as they are
+ * read, leaving out every file marked in either run, since its missing
+ * findings were not fixed; only the marked files are held in memory.
+ *
+ * Usage: java ResultHistory FILE runs
+ *        java ResultHistory FILE diff [OLD NEW]
+ *   Runs are numbered from 1; negative numbers count back from the
+ *   latest run (-1). diff compares the last two runs by default.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ResultHistory implements ResultSink
+{
+    private static final int INDEX_ENTRY_BYTES = 40;
+    private static final int FINGERPRINT_BITS = 24;
+    private static final int INITIAL_FINDINGS = 1024;
+    private static final int UNREAD = 0x7f; // the rule number of a marker
+
+    private final File file;
+    private final Map<String, Integer> ids = new HashMap<>();
+    private final List<String> newNames = new ArrayList<>();
+    private final Map<File, File> topLevels = new HashMap<>(); // by dir
+    private long[] findings = new long[INITIAL_FINDINGS];
+    private int size = 0;
+    private long errors = 0;
+    private long unread = 0; // markers among the findings
+
+    private ResultHistory (File file)
+    {
+        this.file = file;
+    }
+
+    /**
+     * Opens a history for appending a run, creating it if it does not
+     * exist.
+     *
+     * @param file the history file
+     * @return the history
+     */
+    public static ResultHistory open(File file) throws IOException
+    {
+        ResultHistory history = new ResultHistory(file);
+        File names = new File(file.getPath() + ".names");
+        if (names.exists())
+        {
+            try (BufferedReader reader = new BufferedReader(
+                new FileReader(names)))
+            {
+                String line;
+                while ((line = reader.readLine()) != null)
+                {
+                    history.ids.put(line, history.ids.size());
+                }
+            }
+        }
+        return history;
+    }
+
+    /**
+     * Records the findings of one file, or marks it if it was not
+     * analyzed in full.
+     *
+     * @param result the result of one file of the batch
+     */
+    public synchronized void accept(FileResult result)
+    {
+        boolean marked = result.failure != null || result.triage != null;
+        if (result.tokens.isEmpty() && !marked)
+        {
+            return;
+        }
+        String key = key(result.path);
+        Integer id = ids.get(key);
+        if (id == null)
+        {
+            id = ids.size();
+            ids.put(key, id);
+            newNames.add(key);
+        }
+        if (marked)
+        {
+            add(encode(id, 0, UNREAD, false));
+            unread++;
+        }
+        Map<String, Integer> seen = new HashMap<>();
+        for (Scanner.Token t : result.tokens)
+        {
+            int occurrence = seen.merge(t.error, 1, Integer::sum);
+            add(encode(id, fingerprint(t.error, occurrence),
+                Rule.of(t).number, t.sure));
+            if (t.sure)
+            {
+                errors++;
+            }
+        }
+    }
+
+    private void add(long finding)
+    {
+        if (size == findings.length)
+        {
+            findings = Arrays.copyOf(findings, 2 * size);
+        }
+        findings[size++] = finding;
+    }
+
+    /**
+     * @param path the path of an analyzed file
+     * @return the path relative to the top level of its repository
+     */
+    private String key(String path)
+    {
+        File file = new File(FindingCache.key(new File(path)));
+        File top = topLevel(file.getParentFile());
+        String key = top == null ? file.getPath()
+            : top.toPath().relativize(file.toPath()).toString();
+        return key.replace(File.separatorChar, '/');
+    }
+
+    /**
+     * @return the nearest directory at or above directory that holds a
+     *         .git, or null; remembered for every directory looked at
+     */
+    private File topLevel(File directory)
+    {
+        if (directory == null)
+        {
+            return null;
+        }
+        if (!topLevels.containsKey(directory))
+        {
+            topLevels.put(directory, new File(directory, ".git").exists()
+                ? directory : topLevel(directory.getParentFile()));
+        }
+        return topLevels.get(directory);
+    }
+
+    /**
+     * Appends the recorded run to the history: its findings first, then
+     * the new file names and last its index entry, so that a run that
+     * was cut off is simply not in the index.
+     */
+    public synchronized void append() throws IOException
+    {
+        Arrays.sort(findings, 0, size);
+        long offset = file.length(); // past any run that was cut off
+        try (DataOutputStream out = new DataOutputStream(
+            new BufferedOutputStream(new FileOutputStream(file, true))))
+        {
+            for (int i = 0; i < size; i++)
+            {
+                out.writeLong(findings[i]);
+            }
+        }
+        try (PrintWriter out = new PrintWriter(new FileOutputStream(
+            new File(file.getPath() + ".names"), true)))
+        {
+            for (String name : newNames)
+            {
+                out.println(name);
+            }
+            if (out.checkError())
+            {
+                throw new IOException("Could not write the history");
+            }
+        }
+        newNames.clear();
+        try (DataOutputStream out = new DataOutputStream(
+            new FileOutputStream(new File(file.getPath() + ".idx"), true)))
+        {
+            out.writeLong(System.currentTimeMillis());
+            out.writeLong(offset);
+            out.writeLong(size);
+            out.writeLong(errors);
+            out.writeLong(size - errors - unread);
+        }
+    }
+
+    /**
+     * Lists the runs or compares two of them.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args) throws IOException
+    {
+        if (args.length == 2 && args[1].equals("runs"))
+        {
+            runs(new File(args[0]), System.out);
+        }
+        else if ((args.length == 2 || args.length == 4)
+            && args[1].equals("diff"))
+        {
+            long[][] index = readIndex(new File(args[0]));
+            try
+            {
+                int older = args.length == 4 ? run(index, args[2]) : -2;
+                int newer = args.length == 4 ? run(index, args[3]) : -1;
+                diff(new File(args[0]), index,
+                    older < 0 ? index.length + older : older - 1,
+                    newer < 0 ? index.length + newer : newer - 1, System.out);
+            }
+            catch (NumberFormatException | ArrayIndexOutOfBoundsException e)
+            {
+                System.out.println("No such run; the history has "
+                    + index.length + " runs");
+            }
+        }
+        else
+        {
+            System.out.println("Usage: java ResultHistory FILE runs\n"
+                + "       java ResultHistory FILE diff [OLD NEW]");
+        }
+    }
+
+    /**
+     * Prints one line per run, from the index only.
+     */
+    private static void runs(File file, PrintStream out) throws IOException
+    {
+        SimpleDateFormat format = new SimpleDateFormat("yyyy-MM-dd HH:mm");
+        long[][] index = readIndex(file);
+        out.printf("%5s  %-16s %10s %10s %10s\n", "run", "time", "findings",
+            "errors", "warnings");
+        for (int i = 0; i < index.length; i++)
+        {
+            out.printf("%5d  %-16s %10d %10d %10d\n", i + 1,
+                format.format(new Date(index[i][0])),
+                index[i][3] + index[i][4], index[i][3], index[i][4]);
+        }
+    }
+
+    /**
+     * Prints the findings of the newer run that the older did not have
+     * ("+") and those of the older that the newer no longer has ("-"),
+     * except in the files that either run did not analyze in full.
+     *
+     * @param older index of the older run
+     * @param newer index of the newer run
+     */
+    private static void diff(File file, long[][] index, int older, int newer,
+        PrintStream out) throws IOException
+    {
+        List<String> names = new ArrayList<>();
+        try (BufferedReader reader = new BufferedReader(
+            new FileReader(file.getPath() + ".names")))
+        {
+            String line;
+            while ((line = reader.readLine()) != null)
+            {
+                names.add(line);
+            }
+        }
+        Set<Integer> marked = new HashSet<>();
+        marked(file, index[older], marked);
+        marked(file, index[newer], marked);
+        int added = 0;
+        int fixed = 0;
+        try (Segment a = new Segment(file, index[older]);
+            Segment b = new Segment(file, index[newer]))
+        {
+            while (a.hasNext() || b.hasNext())
+            {
+                if (b.hasNext() && (!a.hasNext() || b.peek() < a.peek()))
+                {
+                    long finding = b.next();
+                    if (!marked.contains((int) (finding >>> 32)))
+                    {
+                        print(out, "+", finding, names);
+                        added++;
+                    }
+                }
+                else if (a.hasNext() && (!b.hasNext() || a.peek() < b.peek()))
+                {
+                    long finding = a.next();
+                    if (!marked.contains((int) (finding >>> 32)))
+                    {
+                        print(out, "-", finding, names);
+                        fixed++;
+                    }
+                }
+                else
+                {
+                    a.next();
+                    b.next();
+                }
+            }
+        }
+        out.printf("Run %d to run %d: %d new, %d fixed\n", older + 1,
+            newer + 1, added, fixed);
+        if (!marked.isEmpty())
+        {
+            out.println(marked.size() + " files not analyzed in full in one"
+                + " of the runs are left out");
+        }
+    }
+
+    /**
+     * Adds the id of every file marked in a run to the given set.
+     */
+    private static void marked(File file, long[] entry, Set<Integer> ids)
+        throws IOException
+    {
+        try (Segment segment = new Segment(file, entry))
+        {
+            while (segment.hasNext())
+            {
+                long finding = segment.next();
+                if ((int) (finding >>> 1 & 0x7f) == UNREAD)
+                {
+                    ids.add((int) (finding >>> 32));
+                }
+            }
+        }
+    }
+
+    private static void print(PrintStream out, String sign, long finding,
+        List<String> names)
+    {
+        int id = (int) (finding >>> 32);
+        int rule = (int) (finding >>> 1) & 0x7f;
+        String ruleName = "rule " + rule;
+        for (Rule r : Rule.values())
+        {
+            if (r.number == rule)
+            {
+                ruleName = r.toString();
+            }
+        }
+        out.println(sign + " " + (id < names.size() ? names.get(id)
+            : "file " + id) + ": " + ruleName
+            + ((finding & 1) != 0 ? " (error)" : " (warning)"));
+    }
+
+    private static long[][] readIndex(File file) throws IOException
+    {
+        File indexFile = new File(file.getPath() + ".idx");
+        long[][] index = new long[(int) (indexFile.length()
+            / INDEX_ENTRY_BYTES)][5];
+        try (DataInputStream in = new DataInputStream(
+            new BufferedInputStream(new FileInputStream(indexFile))))
+        {
+            for (long[] entry : index)
+            {
+                for (int i = 0; i < entry.length; i++)
+                {
+                    entry[i] = in.readLong();
+                }
+            }
+        }
+        return index;
+    }
+
+    /**
+     * @return the run number given on the command line, checked
+     */
+    private static int run(long[][] index, String argument)
+    {
+        int run = Integer.parseInt(argument);
+        if (run == 0 || Math.abs(run) > index.length)
+        {
+            throw new ArrayIndexOutOfBoundsException(run);
+        }
+        return run;
+    }
+
+    /**
+     * Packs a finding into a long that sorts by file first.
+     */
+    private static long encode(int id, int fingerprint, int rule,
+        boolean sure)
+    {
+        return ((long) id << 32) | ((long) fingerprint << 8)
+            | ((rule & 0x7f) << 1) | (sure ? 1 : 0);
+    }
+
+    /**
+     * @return a 24-bit hash of a message and its occurrence in the file
+     */
+    private static int fingerprint(String message, int occurrence)
+    {
+        int h = message.hashCode() * 31 + occurrence;
+        h ^= h >>> 16;
+        h *= 0x85ebca6b;
+        h ^= h >>> 13;
+        return h & ((1 << FINGERPRINT_BITS) - 1);
+    }
+
+    /**
+     * The sorted findings of one run, read one at a time.
+     */
+    private static class Segment implements AutoCloseable
+    {
+        private final DataInputStream in;
+        private long remaining;
+        private long next;
+        private boolean hasNext;
+
+        Segment (File file, long[] entry) throws IOException
+        {
+            InputStream stream = new FileInputStream(file);
+            stream.skipNBytes(entry[1]);
+            this.in = new DataInputStream(new BufferedInputStream(stream));
+            this.remaining = entry[2];
+            advance();
+        }
+
+        boolean hasNext()
+        {
+            return hasNext;
+        }
+
+        long peek()
+        {
+            return next;
+        }
+
+        long next() throws IOException
+        {
+            long value = next;
+            advance();
+            return value;
+        }
+
+        private void advance() throws IOException
+        {
+            hasNext = remaining > 0;
+            if (hasNext)
+            {
+                remaining--;
+                try
+                {
+                    next = in.readLong();
+                }
+                catch (EOFException e)
+                {
+                    throw new IOException("The history is truncated", e);
+                }
+            }
+        }
+
+        public void close() throws IOException
+        {
+            in.close();
+        }
+    }
+}
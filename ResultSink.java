@@ -0,0 +1,15 @@
+
+/**
+ * Receives the result of every file of a batch run, in any order and
+ * possibly from several threads at once.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public interface ResultSink
+{
+    /**
+     * @param result the result of one file of the batch
+     */
+    void accept(FileResult result);
+}
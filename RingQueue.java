@@ -0,0 +1,111 @@
+
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
+
+/**
+ * A bounded, lock-free queue for any number of producer and consumer
+ * threads (a ring buffer whose slots carry sequence numbers). Neither
+ * offer nor poll ever blocks: they report a full or empty queue instead
+ * and leave it to the caller to decide how to wait.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public final class RingQueue<T>
+{
+    private final Object[] items;
+    private final AtomicLongArray sequences;
+    private final int mask;
+    private final AtomicLong head = new AtomicLong(); // next to poll
+    private final AtomicLong tail = new AtomicLong(); // next to offer
+
+    /**
+     * @param capacity minimum number of items the queue can hold; rounded
+     *                 up to a power of two
+     */
+    public RingQueue (int capacity)
+    {
+        int size = 2;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+        items = new Object[size];
+        sequences = new AtomicLongArray(size);
+        mask = size - 1;
+        for (int i = 0; i < size; i++)
+        {
+            sequences.set(i, i);
+        }
+    }
+
+    /**
+     * Adds an item unless the queue is full.
+     *
+     * @param item the item to add
+     * @return false if the queue was full
+     */
+    public boolean offer(T item)
+    {
+        long position = tail.get();
+        while (true)
+        {
+            int slot = (int) (position & mask);
+            long difference = sequences.get(slot) - position;
+            if (difference == 0)
+            {
+                if (tail.compareAndSet(position, position + 1))
+                {
+                    items[slot] = item;
+                    sequences.set(slot, position + 1); // publishes item
+                    return true;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            position = tail.get();
+        }
+    }
+
+    /**
+     * Removes the oldest item, if there is one.
+     *
+     * @return the oldest item, or null if the queue was empty
+     */
+    @SuppressWarnings("unchecked")
+    public T poll()
+    {
+        long position = head.get();
+        while (true)
+        {
+            int slot = (int) (position & mask);
+            long difference = sequences.get(slot) - (position + 1);
+            if (difference == 0)
+            {
+                if (head.compareAndSet(position, position + 1))
+                {
+                    T item = (T) items[slot];
+                    items[slot] = null;
+                    sequences.set(slot, position + mask + 1); // frees slot
+                    return item;
+                }
+            }
+            else if (difference < 0)
+            {
+                return null;
+            }
+            position = head.get();
+        }
+    }
+
+    /**
+     * @return roughly how many items are waiting; exact only when no
+     *         other thread is using the queue
+     */
+    public int size()
+    {
+        return (int) Math.max(0, tail.get() - head.get());
+    }
+}
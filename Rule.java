@@ -0,0 +1,100 @@
+
+/**
+ * The style rules of main.flex, numbered as in its header, so that
+ * findings can be counted per rule. The Scanner only reports a message,
+ * so a finding's rule is recovered from the wording of that message.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public enum Rule
+{
+    LONG_BLOCK(1, "Uncommented block longer than 10 lines"),
+    INDENTATION(3, "Indentation"),
+    BLOCK_COMMENT_FORM(4, "Block comment form"),
+    BLOCK_COMMENT_INDENT(5, "Block comment indentation"),
+    LINE_LENGTH(6, "Line length"),
+    MAGIC_NUMBER(7, "Magic number"),
+    NAME_CASE(8, "Variable name case"),
+    NAME_L_O(9, "Variable named l or O"),
+    SHORT_NAME(10, "Single letter variable name"),
+    CLASS_NAME(11, "Class name case"),
+    BRACE_WHITESPACE(12, "Blank lines and braces"),
+    CONSTRUCT_WHITESPACE(13, "Blank lines around constructs"),
+    KEYWORD_SPACING(14, "Spacing in headers"),
+    IF_ELSE(15, "if/else form"),
+    BREAK(16, "Break in loop"),
+    RETURN(17, "Return placement"),
+    HEADER_COMMENT(18, "Missing block comment"),
+    LOOP_ITERATOR(19, "Loop iterator modified"),
+    MIXED_MODE(20, "Mixed-mode arithmetic"),
+    FOR_AS_WHILE(21, "For loop simulating a while loop"),
+    OTHER(0, "Other");
+
+    public final int number;
+    public final String label;
+
+    Rule (int number, String label)
+    {
+        this.number = number;
+        this.label = label;
+    }
+
+    /**
+     * Finds the rule that produced a finding.
+     *
+     * @param token a finding of the Scanner
+     * @return its rule, or OTHER if the message is not recognized
+     */
+    public static Rule of(Scanner.Token token)
+    {
+        String e = token.error;
+        if (e.startsWith("A Block of more than 10 lines")) return LONG_BLOCK;
+        if (e.startsWith("Indent contains tab")
+            || e.startsWith("Incorrect indentation")) return INDENTATION;
+        if (e.startsWith("Block comment does not have asterisks")
+            || e.startsWith("Single line comment on its own line"))
+        {
+            return BLOCK_COMMENT_FORM;
+        }
+        if (e.startsWith("Block comment is inconsistently"))
+        {
+            return BLOCK_COMMENT_INDENT;
+        }
+        if (e.startsWith("Line exceeds")) return LINE_LENGTH;
+        if (e.startsWith("Potential magic number")) return MAGIC_NUMBER;
+        if (e.startsWith("Variable name ") && e.contains(" always invalid"))
+        {
+            return NAME_L_O;
+        }
+        if (e.startsWith("Variable name ")
+            || e.startsWith("Constant variable ")) return NAME_CASE;
+        if (e.startsWith("Variable ")) return SHORT_NAME;
+        if (e.startsWith("Class/interface name ")) return CLASS_NAME;
+        if (e.startsWith("Opening brace must be")
+            || e.contains("superfluous new line")
+            || e.contains("Superfluous new line")) return BRACE_WHITESPACE;
+        if (e.startsWith("Missing whitespace")) return CONSTRUCT_WHITESPACE;
+        if (e.startsWith("For loop white space")
+            || e.startsWith("Construct should have one space")
+            || e.startsWith("There should be no space between"))
+        {
+            return KEYWORD_SPACING;
+        }
+        if (e.startsWith("If/else statement")) return IF_ELSE;
+        if (e.startsWith("Break statement")) return BREAK;
+        if (e.startsWith("Return statement")
+            || e.startsWith("Missing final return")) return RETURN;
+        if (e.startsWith("Class/interface should be preceded")
+            || e.startsWith("Function/method must be")) return HEADER_COMMENT;
+        if (e.startsWith("Loop iterator ")) return LOOP_ITERATOR;
+        if (e.startsWith("Mixed-mode arithmetic")) return MIXED_MODE;
+        if (e.startsWith("For loop simulates")) return FOR_AS_WHILE;
+        return OTHER;
+    }
+
+    public String toString()
+    {
+        return (number > 0 ? number + ". " : "") + label;
+    }
+}
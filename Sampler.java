@@ -0,0 +1,330 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Random;
+import java.util.concurrent.Callable;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+
+/**
+ * Estimates how many findings a full batch run would report, per rule
+ * and per directory, from a random sample of the files.
+ *
+ * Files are stratified by size and the sample is allocated to the strata
+ * in proportion to their bytes (at least two files per stratum, so that
+ * each has a variance). Every sampled file is analyzed whole, however
+ * large: many rules depend on the rest of the file (the braces around a
+ * line, its indentation depth, the block comment before a function, the
+ * #defines), so findings counted on a piece of a file would be biased.
+ * The largest files make up their own stratum instead. Totals use the
+ * usual stratified estimator; the intervals are 95% normal intervals.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class Sampler
+{
+    private static final long[] STRATUM_LIMITS = {
+        4 * 1024, 16 * 1024, 64 * 1024, 256 * 1024};
+    private static final double Z_95 = 1.96;
+    private static final int MAX_DIRECTORIES = 25;
+    private static final int TOTAL = Rule.values().length; // all rules
+
+    private final List<File> files;
+    private final int sampleSize;
+    private final long seed;
+    private final int threads;
+    private final boolean triage;
+
+    /**
+     * @param files every file of the batch
+     * @param sampleSize about how many files to analyze
+     * @param seed seed of the random sample
+     * @param threads number of analyzing threads
+     * @param triage whether to run Triage on each file first
+     */
+    public Sampler (List<File> files, int sampleSize, long seed, int threads,
+        boolean triage)
+    {
+        this.files = files;
+        this.sampleSize = sampleSize;
+        this.seed = seed;
+        this.threads = threads;
+        this.triage = triage;
+    }
+
+    /**
+     * Draws the sample, analyzes it and prints the estimates.
+     *
+     * @param out where the estimates are printed
+     */
+    public void run(PrintStream out) throws InterruptedException
+    {
+        long start = System.nanoTime();
+        int strata = STRATUM_LIMITS.length + 1;
+        List<List<Integer>> population = new ArrayList<>();
+        long[] bytes = new long[strata];
+        long totalBytes = 0;
+        for (int h = 0; h < strata; h++)
+        {
+            population.add(new ArrayList<>());
+        }
+        for (int i = 0; i < files.size(); i++)
+        {
+            long size = files.get(i).length();
+            int h = stratumOf(size);
+            population.get(h).add(i);
+            bytes[h] += size;
+            totalBytes += size;
+        }
+
+        Random random = new Random(seed);
+        List<List<Observation>> samples = new ArrayList<>();
+        List<Callable<Observation>> tasks = new ArrayList<>();
+        for (int h = 0; h < strata; h++)
+        {
+            List<Integer> members = new ArrayList<>(population.get(h));
+            int n = allocation(members.size(), bytes[h], totalBytes);
+            Collections.shuffle(members, random);
+            int stratum = h;
+            for (int index : members.subList(0, n))
+            {
+                tasks.add(() -> observe(index, stratum));
+            }
+            samples.add(new ArrayList<>());
+        }
+
+        ExecutorService pool = Executors.newFixedThreadPool(threads);
+        long sampledBytes = 0;
+        int unreadable = 0;
+        try
+        {
+            for (Future<Observation> future : pool.invokeAll(tasks))
+            {
+                Observation observation = future.get();
+                samples.get(observation.stratum).add(observation);
+                sampledBytes += observation.bytes;
+                if (observation.unreadable) unreadable++;
+            }
+        }
+        catch (ExecutionException e)
+        {
+            throw new IllegalStateException(e.getCause());
+        }
+        finally
+        {
+            pool.shutdown();
+        }
+
+        out.printf("Sample: %d of %d files, %.1f of %.1f MB (seed %d,"
+            + " %.1f s)\n", tasks.size(), files.size(),
+            sampledBytes / 1e6, totalBytes / 1e6, seed,
+            (System.nanoTime() - start) / 1e9);
+        out.printf("Sampled files are analyzed whole; files of %d KB and"
+            + " up form their own stratum\n",
+            STRATUM_LIMITS[STRATUM_LIMITS.length - 1] / 1024);
+        if (unreadable > 0)
+        {
+            out.printf("%d sampled files could not be read or analyzed and"
+                + " were counted as clean\n", unreadable);
+        }
+        out.println("==============================");
+        out.println("Estimated findings per rule (95% confidence):");
+        for (Rule rule : Rule.values())
+        {
+            double[] estimate = estimate(samples, population,
+                rule.ordinal(), null);
+            if (estimate[0] > 0)
+            {
+                out.printf("  %-40s %10.0f +/- %.0f\n", rule, estimate[0],
+                    estimate[1]);
+            }
+        }
+        double[] all = estimate(samples, population, TOTAL, null);
+        out.printf("  %-40s %10.0f +/- %.0f\n", "All rules", all[0], all[1]);
+
+        out.println("==============================");
+        out.println("Estimated findings per directory (95% confidence):");
+        Map<String, double[]> directories = new HashMap<>();
+        for (int i = 0; i < files.size(); i++)
+        {
+            String directory = directoryOf(i);
+            if (!directories.containsKey(directory))
+            {
+                directories.put(directory,
+                    estimate(samples, population, TOTAL, directory));
+            }
+        }
+        List<Map.Entry<String, double[]>> ranked =
+            new ArrayList<>(directories.entrySet());
+        ranked.sort((a, b)->Double.compare(b.getValue()[0], a.getValue()[0]));
+        for (Map.Entry<String, double[]> entry
+            : ranked.subList(0, Math.min(MAX_DIRECTORIES, ranked.size())))
+        {
+            out.printf("  %-40s %10.0f +/- %.0f\n", entry.getKey(),
+                entry.getValue()[0], entry.getValue()[1]);
+        }
+        if (ranked.size() > MAX_DIRECTORIES)
+        {
+            out.printf("  (%d more directories)\n",
+                ranked.size() - MAX_DIRECTORIES);
+        }
+    }
+
+    private static int stratumOf(long size)
+    {
+        int h = 0;
+        while (h < STRATUM_LIMITS.length && size >= STRATUM_LIMITS[h])
+        {
+            h++;
+        }
+        return h;
+    }
+
+    /**
+     * Share of the sample given to one stratum: proportional to its
+     * bytes, at least two files, at most all of them.
+     */
+    private int allocation(int members, long bytes, long totalBytes)
+    {
+        if (members == 0)
+        {
+            return 0;
+        }
+        long share = totalBytes == 0 ? 0
+            : Math.round((double) sampleSize * bytes / totalBytes);
+        return (int) Math.min(members, Math.max(2, share));
+    }
+
+    private String directoryOf(int index)
+    {
+        String parent = files.get(index).getParent();
+        return parent == null ? "." : parent;
+    }
+
+    /**
+     * Estimates the total of one column of the observations over the
+     * whole population, or over one directory of it.
+     *
+     * @param samples the observations of each stratum
+     * @param population the files of each stratum
+     * @param key a Rule ordinal, or TOTAL for all rules
+     * @param directory only count files directly in this directory, or
+     *                  null for all files
+     * @return the estimated total and the half width of its interval
+     */
+    private double[] estimate(List<List<Observation>> samples,
+        List<List<Integer>> population, int key, String directory)
+    {
+        double total = 0;
+        double variance = 0;
+        for (int h = 0; h < samples.size(); h++)
+        {
+            List<Observation> sample = samples.get(h);
+            int n = sample.size();
+            int populationSize = population.get(h).size();
+            if (n == 0)
+            {
+                continue;
+            }
+            double[] values = new double[n];
+            double sum = 0;
+            for (int i = 0; i < n; i++)
+            {
+                Observation o = sample.get(i);
+                if (directory == null
+                    || directory.equals(directoryOf(o.index)))
+                {
+                    values[i] = o.counts[key];
+                }
+                sum += values[i];
+            }
+            double mean = sum / n;
+            total += populationSize * mean;
+            if (n > 1)
+            {
+                double squares = 0;
+                for (double v : values)
+                {
+                    squares += (v - mean) * (v - mean);
+                }
+                variance += (double) populationSize * populationSize
+                    * (1 - (double) n / populationSize)
+                    * (squares / (n - 1)) / n;
+            }
+        }
+        return new double[] {total, Z_95 * Math.sqrt(variance)};
+    }
+
+    /**
+     * Analyzes one sampled file.
+     */
+    private Observation observe(int index, int stratum)
+    {
+        File file = files.get(index);
+        Observation observation =
+            new Observation(index, stratum, file.length());
+        try
+        {
+            sample(file, observation);
+        }
+        catch (IOException | RuntimeException | StackOverflowError e)
+        {
+            observation.unreadable = true;
+        }
+        return observation;
+    }
+
+    private void sample(File file, Observation observation)
+        throws IOException
+    {
+        Triage verdict = triage ? Triage.inspect(file) : null;
+        if (verdict != null && verdict.skip)
+        {
+            return;
+        }
+        String source = Analyzer.readSource(file);
+        if (verdict != null)
+        {
+            count(observation.counts, Triage.checkLineLengths(source));
+            return;
+        }
+        count(observation.counts, Analyzer.analyze(source));
+    }
+
+    private static void count(double[] counts, List<Scanner.Token> tokens)
+    {
+        for (Scanner.Token t : tokens)
+        {
+            counts[Rule.of(t).ordinal()]++;
+            counts[TOTAL]++;
+        }
+    }
+
+    /**
+     * The findings of one sampled file.
+     */
+    private static class Observation
+    {
+        final int index;
+        final int stratum;
+        final long bytes;
+        final double[] counts = new double[TOTAL + 1];
+        boolean unreadable = false;
+
+        Observation (int index, int stratum, long bytes)
+        {
+            this.index = index;
+            this.stratum = stratum;
+            this.bytes = bytes;
+        }
+    }
+}
@@ -0,0 +1,198 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.io.PrintStream;
+import java.lang.management.GarbageCollectorMXBean;
+import java.lang.management.ManagementFactory;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+/**
+ * Measures how batch analysis scales with cores: the Pipeline analyzes
+ * the same generated corpus, writing a full report to a discarding
+ * stream, with 1, 2, 4, 8, 16 and more scanning threads, up to twice
+ * the number of processors. For each thread count it prints the best
+ * time of a few runs and
+ *
+ *   speedup     the time with one thread divided by this time,
+ *   efficiency  the speedup divided by the number of threads,
+ *   idle        the least and the greatest share of the run that a
+ *               scanning thread was not analyzing (waiting for input,
+ *               for the writer or for the others to finish); a wide
+ *               range means the work was spread unevenly,
+ *   GC ms       collection time during the run.
+ *
+ * Contention in reading, report writing or allocation shows up as
+ * efficiency falling while idle time or GC time rises; --per-thread also
+ * prints the idle share of every scanning thread.
+ *
+ * Usage: java ScalingBenchmark [--files N] [--runs N] [--max-threads N]
+ *            [--seed FILE] [--per-thread]
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ScalingBenchmark
+{
+    private static final long CORPUS_SEED = 42;
+
+    /**
+     * Runs the benchmark.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args)
+        throws IOException, InterruptedException
+    {
+        int fileCount = 2000;
+        int runs = 3;
+        int maxThreads = 2 * Runtime.getRuntime().availableProcessors();
+        String seed = BenchmarkCorpus.DEFAULT_SEED;
+        boolean perThread = false;
+        boolean usage = false;
+        try
+        {
+            for (int i = 0; i < args.length; i++)
+            {
+                switch (args[i])
+                {
+                    case "--files":
+                        fileCount = Integer.parseInt(args[++i]);
+                        break;
+                    case "--runs":
+                        runs = Integer.parseInt(args[++i]);
+                        break;
+                    case "--max-threads":
+                        maxThreads = Integer.parseInt(args[++i]);
+                        break;
+                    case "--seed":
+                        seed = args[++i];
+                        break;
+                    case "--per-thread":
+                        perThread = true;
+                        break;
+                    default:
+                        usage = true;
+                        break;
+                }
+            }
+        }
+        catch (ArrayIndexOutOfBoundsException | NumberFormatException e)
+        {
+            usage = true;
+        }
+        if (usage || fileCount < 1 || runs < 1 || maxThreads < 1)
+        {
+            System.out.println("Usage: java ScalingBenchmark [--files N]"
+                + " [--runs N] [--max-threads N] [--seed FILE]"
+                + " [--per-thread]");
+            return;
+        }
+
+        File directory = Files.createTempDirectory("scaling").toFile();
+        List<File> files = new BenchmarkCorpus(new File(seed))
+            .writeBatch(directory, fileCount, CORPUS_SEED);
+        try
+        {
+            List<Integer> counts = new ArrayList<>();
+            for (int threads = 1; threads < maxThreads; threads *= 2)
+            {
+                counts.add(threads);
+            }
+            counts.add(maxThreads);
+
+            run(files, maxThreads); // warms up the JIT
+            System.out.printf("%d files, best of %d runs\n", files.size(),
+                runs);
+            System.out.printf("%8s %10s %8s %11s %13s %8s\n", "threads",
+                "seconds", "speedup", "efficiency", "idle", "GC ms");
+            double single = 0;
+            for (int threads : counts)
+            {
+                double[] best = null;
+                for (int run = 0; run < runs; run++)
+                {
+                    double[] measured = run(files, threads);
+                    if (best == null || measured[0] < best[0])
+                    {
+                        best = measured;
+                    }
+                }
+                if (threads == 1)
+                {
+                    single = best[0];
+                }
+                double speedup = single / best[0];
+                double[] idle = Arrays.copyOfRange(best, 2, best.length);
+                double[] sorted = idle.clone();
+                Arrays.sort(sorted);
+                System.out.printf("%8d %10.3f %8.2f %10.0f%% %5.0f%%-%5.0f%%"
+                    + " %8.0f\n", threads, best[0], speedup,
+                    100 * speedup / threads, 100 * sorted[0],
+                    100 * sorted[sorted.length - 1], best[1]);
+                if (perThread)
+                {
+                    StringBuilder shares = new StringBuilder("    idle:");
+                    for (double share : idle)
+                    {
+                        shares.append(String.format(" %.0f%%", 100 * share));
+                    }
+                    System.out.println(shares);
+                }
+            }
+        }
+        finally
+        {
+            for (File file : files)
+            {
+                file.delete();
+            }
+            directory.delete();
+        }
+    }
+
+    /**
+     * Analyzes the whole corpus once.
+     *
+     * @return the seconds it took, the milliseconds spent in collections
+     *         and the idle share of each scanning thread
+     */
+    private static double[] run(List<File> files, int threads)
+        throws InterruptedException
+    {
+        OrderedReport report = new OrderedReport(
+            new PrintStream(OutputStream.nullOutputStream()), files.size());
+        Pipeline pipeline = new Pipeline(files, threads, report, false, null,
+            false, null, null);
+        long gcBefore = collectionMillis();
+        long start = System.nanoTime();
+        pipeline.run();
+        report.finish();
+        long elapsed = System.nanoTime() - start;
+        long gc = collectionMillis() - gcBefore;
+
+        long[] busy = pipeline.busyNanos();
+        double[] measured = new double[2 + busy.length];
+        measured[0] = elapsed / 1e9;
+        measured[1] = gc;
+        for (int i = 0; i < busy.length; i++)
+        {
+            measured[2 + i] = 1 - (double) busy[i] / elapsed;
+        }
+        return measured;
+    }
+
+    private static long collectionMillis()
+    {
+        long total = 0;
+        for (GarbageCollectorMXBean collector
+            : ManagementFactory.getGarbageCollectorMXBeans())
+        {
+            total += Math.max(0, collector.getCollectionTime());
+        }
+        return total;
+    }
+}
@@ -0,0 +1,38 @@
+
+/**
+ * Watches one Scanner run for profiling. The Scanner reports each match
+ * of its expensive rules (the ones that re-match the text with regular
+ * expressions); the driver reading the tokens reports the passes.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public interface ScanObserver
+{
+    /**
+     * @param pass the pass that starts, 1 to 6
+     */
+    void passStarted(int pass);
+
+    /**
+     * @param pass the pass that ended, 1 to 6
+     * @param findings findings reported during the pass
+     * @param pushback characters pushed back during the pass
+     */
+    void passFinished(int pass, int findings, int pushback);
+
+    /**
+     * Called as an expensive rule's action begins.
+     */
+    void ruleStarted();
+
+    /**
+     * Called as an expensive rule's action ends.
+     *
+     * @param rule name of the rule
+     * @param line line of the match
+     * @param length characters matched (after any pushback)
+     * @param token the finding, or Token.NULL if there was none
+     */
+    void ruleFinished(String rule, int line, int length, Scanner.Token token);
+}
@@ -6,6 +6,8 @@ import java.util.Arrays;
 import java.util.regex.Pattern;
 import java.util.regex.Matcher;
 import java.util.Stack;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
 import java.lang.Integer;
 import java.io.IOException;
 
@@ -23,8 +25,9 @@ import java.io.IOException;
  * 5.  Block comments must not be indented or consistently indented 
  *     once.
  * 6.  Lines may not be longer than 132 lines.
- * 7.  No magic numbers (basic test - a number not 0, 1, 0.0, 1.0 not
- *     preceded anywhere by " final " or "#define ").
+ * 7.  No magic numbers (a number not 0, 1, 0.0, 1.0 outside of the
+ *     definition of a constant - "#define", const, final or an enum -
+ *     and of the size in an array declaration).
  * 8.  Variable names should be lower camel case or upper snake case
  *     (required if the variable is detected to be a constant).
  * 9.  Variables should not be called "l" or "O".
@@ -54,14 +57,14 @@ import java.io.IOException;
  *     interface definition).
  * 18. All functions (C), methods (java), and classes (java) must have a
  *     block comment preceding them.
- * 
- * 
- * The scanner does not do the following:
- * 1. Mixed Mode Arithmetic Detection
- * 2. Actual Magic Number Detection
- * 3. Detection that a loop iterator is not modified within the loop
- * 4. Semantics of a for loop ("for loops should not simulate while 
- *    loops")
+ * 19. A for loop's iterator should not be modified within the loop
+ *     (assigned, incremented or decremented in its body).
+ * 20. No mixed-mode arithmetic: the operands of +, -, *, / and % should
+ *     both be integers or both be floating point (as far as their
+ *     declarations in the file show).
+ * 21. For loops should not simulate while loops: init, condition and
+ *     step must all be present, and the step must count the variable
+ *     that the init starts and the condition tests.
  */
 
 
@@ -93,1704 +96,37 @@ public class Scanner {
      0,  0,  1,  2,  3,  4,  1,  5,  6,  7,  8,  9, 10, 11
   };
 
+  /*
+   * The tables below are not unpacked here: ScannerTables reads them from
+   * the precomputed resource Scanner.tables, one lexical state at a time
+   * (see yybegin). ScannerTableWriter describes how to redo this after
+   * regenerating this file with JFlex.
+   */
+
   /**
    * Top-level table for translating characters to character classes
    */
-  private static final int [] ZZ_CMAP_TOP = zzUnpackcmap_top();
-
-  private static final String ZZ_CMAP_TOP_PACKED_0 =
-    "\1\0\37\u0100\1\u0200\267\u0100\10\u0300\u1020\u0100";
-
-  private static int [] zzUnpackcmap_top() {
-    int [] result = new int[4352];
-    int offset = 0;
-    offset = zzUnpackcmap_top(ZZ_CMAP_TOP_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpackcmap_top(String packed, int offset, int [] result) {
-    int i = 0;       /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length();
-    while (i < l) {
-      int count = packed.charAt(i++);
-      int value = packed.charAt(i++);
-      do result[j++] = value; while (--count > 0);
-    }
-    return j;
-  }
-
+  private static final int [] ZZ_CMAP_TOP = ScannerTables.CMAP_TOP;
 
   /**
    * Second-level tables for translating characters to character classes
    */
-  private static final int [] ZZ_CMAP_BLOCKS = zzUnpackcmap_blocks();
-
-  private static final String ZZ_CMAP_BLOCKS_PACKED_0 =
-    "\11\0\1\1\1\2\1\3\1\4\1\5\22\0\1\1"+
-    "\1\6\1\7\1\10\1\0\2\6\1\0\1\11\1\12"+
-    "\1\13\1\6\1\0\1\6\1\14\1\15\12\16\1\6"+
-    "\1\17\1\0\1\20\1\0\1\6\1\0\32\21\1\6"+
-    "\1\22\2\6\1\23\1\0\1\24\1\25\1\26\1\27"+
-    "\1\30\1\31\1\21\1\32\1\33\1\21\1\34\1\35"+
-    "\1\21\1\36\1\37\1\40\1\21\1\41\1\42\1\43"+
-    "\1\44\1\45\1\46\3\21\1\47\1\0\1\50\1\6"+
-    "\6\0\1\3\u01a2\0\2\3\326\0\u0100\51";
-
-  private static int [] zzUnpackcmap_blocks() {
-    int [] result = new int[1024];
-    int offset = 0;
-    offset = zzUnpackcmap_blocks(ZZ_CMAP_BLOCKS_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpackcmap_blocks(String packed, int offset, int [] result) {
-    int i = 0;       /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length();
-    while (i < l) {
-      int count = packed.charAt(i++);
-      int value = packed.charAt(i++);
-      do result[j++] = value; while (--count > 0);
-    }
-    return j;
-  }
+  private static final int [] ZZ_CMAP_BLOCKS = ScannerTables.CMAP_BLOCKS;
 
   /**
    * Translates DFA states to action switch labels.
    */
-  private static final int [] ZZ_ACTION = zzUnpackAction();
-
-  private static final String ZZ_ACTION_PACKED_0 =
-    "\20\0\1\1\1\0\1\2\1\0\3\2\1\0\7\2"+
-    "\1\0\7\2\3\0\12\2\1\3\1\0\6\3\2\0"+
-    "\11\3\1\4\10\0\2\5\11\0\2\6\45\0\1\7"+
-    "\1\10\71\0\1\4\3\0\1\2\14\0\1\11\3\5"+
-    "\4\0\2\12\1\13\20\0\3\14\2\0\2\15\33\0"+
-    "\1\2\6\0\3\14\7\0\1\16\2\0\1\17\7\0"+
-    "\1\15\13\0\2\20\12\0\1\2\3\0\2\14\17\0"+
-    "\1\11\1\21\3\0\1\22\1\0\3\23\13\0\3\14"+
-    "\1\2\3\0\1\2\6\0\1\24\1\14\1\0\1\25"+
-    "\1\26\15\0\1\16\12\0\1\2\11\0\1\25\1\0"+
-    "\1\24\3\0\1\27\1\0\1\27\34\0\1\30\10\0"+
-    "\2\20\1\2\5\0\1\25\1\24\16\0\1\31\1\21"+
-    "\1\0\2\5\1\0\1\21\1\0\1\32\1\23\1\0"+
-    "\1\23\2\0\3\23\1\2\2\0\1\2\4\0\1\24"+
-    "\1\14\1\0\1\2\4\0\3\14\3\0\3\23\2\0"+
-    "\1\2\23\0\1\2\14\0\1\25\31\0\2\15\5\0"+
-    "\1\33\15\0\1\30\1\2\3\0\2\20\1\0\1\33"+
-    "\10\0\1\21\4\0\1\11\3\0\1\32\1\23\1\0"+
-    "\1\2\1\23\1\0\1\2\2\0\1\24\1\2\1\14"+
-    "\1\0\1\32\1\23\1\0\1\23\2\0\1\34\13\0"+
-    "\1\34\1\2\45\0\1\16\2\0\1\26\25\0\1\30"+
-    "\1\25\1\0\2\35\25\0\1\16\5\0\1\34\1\25"+
-    "\61\0\1\2\10\0\1\36\44\0\4\37\1\34\37\0"+
-    "\1\2\33\0\2\37\22\0\1\27\3\0\1\27\1\0"+
-    "\1\40\13\0\1\15\5\0\2\41\22\0\1\25\2\0"+
-    "\1\42\3\0\1\42\7\0\1\43\3\0\2\44\6\0"+
-    "\1\40\22\0\1\27\4\0\1\27\4\0\1\45\11\0"+
-    "\1\46\1\42\11\0\2\41\1\2\25\0\1\47\57\0"+
-    "\1\46\1\2\4\0\2\41\1\0\1\42\111\0\1\46"+
-    "\1\25\212\0\1\50\35\0\1\15\1\0\1\15\26\0"+
-    "\1\50\23\0\1\50\2\0\1\15\11\0\2\51\4\0"+
-    "\1\50\21\0\1\52\10\0\1\50\3\0\1\15\12\0";
-
-  private static int [] zzUnpackAction() {
-    int [] result = new int[1494];
-    int offset = 0;
-    offset = zzUnpackAction(ZZ_ACTION_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpackAction(String packed, int offset, int [] result) {
-    int i = 0;       /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length();
-    while (i < l) {
-      int count = packed.charAt(i++);
-      int value = packed.charAt(i++);
-      do result[j++] = value; while (--count > 0);
-    }
-    return j;
-  }
-
+  private static final int [] ZZ_ACTION = ScannerTables.ACTION;
 
   /**
    * Translates a state to a row index in the transition table
    */
-  private static final int [] ZZ_ROWMAP = zzUnpackRowMap();
-
-  private static final String ZZ_ROWMAP_PACKED_0 =
-    "\0\0\0\52\0\124\0\176\0\250\0\322\0\374\0\u0126"+
-    "\0\u0150\0\u017a\0\u01a4\0\u01ce\0\u01f8\0\u0222\0\u024c\0\u0276"+
-    "\0\u02a0\0\u02ca\0\u02a0\0\u02f4\0\u031e\0\u0348\0\u0372\0\u039c"+
-    "\0\u03c6\0\u03f0\0\u041a\0\u0444\0\u046e\0\u0498\0\u04c2\0\u04ec"+
-    "\0\u0516\0\u0540\0\u056a\0\u0594\0\u05be\0\u05e8\0\u0612\0\u063c"+
-    "\0\u0666\0\u0690\0\u06ba\0\u06e4\0\u070e\0\u0738\0\u0762\0\u078c"+
-    "\0\u07b6\0\u07e0\0\u080a\0\u0834\0\u02a0\0\u085e\0\u0444\0\u056a"+
-    "\0\u0888\0\u08b2\0\u08dc\0\u0906\0\u0930\0\u095a\0\u0984\0\u09ae"+
-    "\0\u09d8\0\u0a02\0\u0a2c\0\u0a56\0\u0a80\0\u0aaa\0\u0ad4\0\u08b2"+
-    "\0\u0afe\0\u0b28\0\u0b52\0\u02a0\0\u0b7c\0\u0ba6\0\u0bd0\0\u031e"+
-    "\0\u02a0\0\u0bfa\0\u0348\0\u0c24\0\u0372\0\u0c4e\0\u0c78\0\u03c6"+
-    "\0\u03f0\0\u0ca2\0\u041a\0\u02a0\0\u0ccc\0\u0444\0\u0cf6\0\u0d20"+
-    "\0\u0498\0\u04c2\0\u0d4a\0\u0d74\0\u0d9e\0\u0516\0\u0dc8\0\u0df2"+
-    "\0\u0e1c\0\u0e46\0\u0e70\0\u0e9a\0\u0ec4\0\u0eee\0\u0594\0\u0f18"+
-    "\0\u0f42\0\u0f6c\0\u05be\0\u0f96\0\u0fc0\0\u05e8\0\u0612\0\u0fea"+
-    "\0\u06e4\0\u1014\0\u0738\0\u0762\0\u078c\0\u07b6\0\u07e0\0\u080a"+
-    "\0\u103e\0\u1068\0\u02a0\0\u02a0\0\u1092\0\u10bc\0\u10e6\0\u1110"+
-    "\0\u113a\0\u1164\0\u118e\0\u11b8\0\u11e2\0\u120c\0\u1236\0\u06ba"+
-    "\0\u1260\0\u128a\0\u12b4\0\u12de\0\u1308\0\u1332\0\u135c\0\u1386"+
-    "\0\u13b0\0\u13da\0\u1404\0\u142e\0\u1458\0\u1482\0\u14ac\0\u14d6"+
-    "\0\u1500\0\u0834\0\u152a\0\u1554\0\u157e\0\u15a8\0\u08b2\0\u0906"+
-    "\0\u15d2\0\u08dc\0\u0a02\0\u0a2c\0\u0a56\0\u0a80\0\u0aaa\0\u0ad4"+
-    "\0\u15fc\0\u1626\0\u1650\0\u167a\0\u16a4\0\u16ce\0\u16f8\0\u1722"+
-    "\0\u174c\0\u1776\0\u17a0\0\u17ca\0\u17f4\0\u16a4\0\u0984\0\u181e"+
-    "\0\u1848\0\u08b2\0\u1872\0\u189c\0\u18c6\0\u18f0\0\u191a\0\u1944"+
-    "\0\u196e\0\u1998\0\u19c2\0\u19ec\0\u1a16\0\u1a40\0\u02a0\0\u1a6a"+
-    "\0\u1a94\0\u1abe\0\u1ae8\0\u1b12\0\u1a94\0\u1b3c\0\u02a0\0\u1b66"+
-    "\0\u02a0\0\u1b90\0\u1bba\0\u1be4\0\u1c0e\0\u1c38\0\u1c62\0\u1c8c"+
-    "\0\u1cb6\0\u1ce0\0\u1d0a\0\u1d34\0\u1d5e\0\u1d88\0\u1db2\0\u1ddc"+
-    "\0\u1e06\0\u02a0\0\u04ec\0\u1e30\0\u1e5a\0\u1e84\0\u02a0\0\u1eae"+
-    "\0\u1ed8\0\u1f02\0\u1f2c\0\u1f56\0\u1f80\0\u1faa\0\u1fd4\0\u1ffe"+
-    "\0\u2028\0\u2052\0\u207c\0\u20a6\0\u20d0\0\u20fa\0\u2124\0\u214e"+
-    "\0\u2178\0\u21a2\0\u21cc\0\u21f6\0\u2220\0\u224a\0\u2274\0\u229e"+
-    "\0\u22c8\0\u22f2\0\u231c\0\u063c\0\u2346\0\u2370\0\u239a\0\u23c4"+
-    "\0\u23ee\0\u2418\0\u2442\0\u063c\0\u246c\0\u2496\0\u24c0\0\u24ea"+
-    "\0\u2514\0\u253e\0\u2568\0\u2592\0\u25bc\0\u25e6\0\u2610\0\u02a0"+
-    "\0\u263a\0\u2664\0\u268e\0\u26b8\0\u26e2\0\u270c\0\u2736\0\u1092"+
-    "\0\u2760\0\u278a\0\u27b4\0\u27de\0\u2808\0\u2832\0\u285c\0\u2886"+
-    "\0\u28b0\0\u28da\0\u2904\0\u02a0\0\u292e\0\u2958\0\u2982\0\u29ac"+
-    "\0\u29d6\0\u2a00\0\u2a2a\0\u2a54\0\u2a7e\0\u2aa8\0\u2ad2\0\u0984"+
-    "\0\u2afc\0\u2b26\0\u2b50\0\u0906\0\u2b7a\0\u2ba4\0\u2bce\0\u2bf8"+
-    "\0\u2c22\0\u2c4c\0\u2c76\0\u2ca0\0\u2cca\0\u2cf4\0\u2d1e\0\u2d48"+
-    "\0\u2d72\0\u1a6a\0\u2d9c\0\u2dc6\0\u1a6a\0\u2df0\0\u2e1a\0\u2e44"+
-    "\0\u2e6e\0\u02a0\0\u2e98\0\u02a0\0\u04ec\0\u2ec2\0\u2eec\0\u2f16"+
-    "\0\u2f40\0\u2f6a\0\u2f94\0\u2fbe\0\u2fe8\0\u3012\0\u303c\0\u3066"+
-    "\0\u3090\0\u0444\0\u0df2\0\u30ba\0\u1e06\0\u30e4\0\u310e\0\u3138"+
-    "\0\u0d4a\0\u3162\0\u318c\0\u31b6\0\u31e0\0\u320a\0\u3234\0\u02a0"+
-    "\0\u1be4\0\u325e\0\u02a0\0\u02a0\0\u3288\0\u32b2\0\u32dc\0\u3306"+
-    "\0\u3330\0\u335a\0\u2442\0\u3384\0\u33ae\0\u33d8\0\u3402\0\u342c"+
-    "\0\u3456\0\u3480\0\u34aa\0\u34d4\0\u34fe\0\u3528\0\u3552\0\u357c"+
-    "\0\u35a6\0\u35d0\0\u35fa\0\u3624\0\u128a\0\u364e\0\u3678\0\u36a2"+
-    "\0\u36cc\0\u36f6\0\u3720\0\u374a\0\u3774\0\u379e\0\u37c8\0\u37f2"+
-    "\0\u2442\0\u381c\0\u3846\0\u3870\0\u05be\0\u389a\0\u02a0\0\u38c4"+
-    "\0\u38ee\0\u3918\0\u25bc\0\u3942\0\u396c\0\u3480\0\u3996\0\u39c0"+
-    "\0\u39ea\0\u3a14\0\u3a3e\0\u3a68\0\u3a92\0\u3abc\0\u3ae6\0\u3b10"+
-    "\0\u3b3a\0\u3b64\0\u3b8e\0\u3bb8\0\u3be2\0\u3c0c\0\u3c36\0\u3c60"+
-    "\0\u3c8a\0\u3cb4\0\u3cde\0\u02a0\0\u3d08\0\u3d32\0\u3d5c\0\u3d86"+
-    "\0\u3db0\0\u3dda\0\u3e04\0\u3e2e\0\u0444\0\u3e58\0\u167a\0\u3e82"+
-    "\0\u3eac\0\u3ed6\0\u3f00\0\u3f2a\0\u08b2\0\u0906\0\u3f54\0\u3f7e"+
-    "\0\u3fa8\0\u3fd2\0\u3ffc\0\u4026\0\u4050\0\u407a\0\u40a4\0\u40ce"+
-    "\0\u40f8\0\u4122\0\u414c\0\u4176\0\u41a0\0\u02a0\0\u41ca\0\u41f4"+
-    "\0\u421e\0\u2df0\0\u1b12\0\u4248\0\u02a0\0\u1be4\0\u4272\0\u1c62"+
-    "\0\u429c\0\u42c6\0\u0444\0\u0df2\0\u42f0\0\u2e98\0\u431a\0\u4344"+
-    "\0\u1c62\0\u436e\0\u4398\0\u43c2\0\u43ec\0\u0444\0\u2fbe\0\u4416"+
-    "\0\u3090\0\u4440\0\u446a\0\u4494\0\u44be\0\u0d20\0\u1d5e\0\u44e8"+
-    "\0\u4512\0\u453c\0\u4566\0\u0d20\0\u1d5e\0\u4590\0\u45ba\0\u45e4"+
-    "\0\u1c38\0\u460e\0\u4638\0\u4662\0\u468c\0\u46b6\0\u46e0\0\u470a"+
-    "\0\u37c8\0\u4734\0\u475e\0\u4788\0\u47b2\0\u47dc\0\u4806\0\u4830"+
-    "\0\u485a\0\u4884\0\u48ae\0\u48d8\0\u32dc\0\u4902\0\u492c\0\u4956"+
-    "\0\u4980\0\u49aa\0\u49d4\0\u49fe\0\u4a28\0\u4a52\0\u4a7c\0\u4aa6"+
-    "\0\u4ad0\0\u063c\0\u4afa\0\u4b24\0\u4b4e\0\u4b78\0\u4ba2\0\u4bcc"+
-    "\0\u4bf6\0\u4c20\0\u4c4a\0\u4c74\0\u4c9e\0\u4cc8\0\u4cf2\0\u4d1c"+
-    "\0\u4d46\0\u4d70\0\u4d9a\0\u4dc4\0\u4dee\0\u4e18\0\u4e42\0\u4e6c"+
-    "\0\u4e96\0\u4ec0\0\u4eea\0\u468c\0\u4f14\0\u4f3e\0\u4f68\0\u4f92"+
-    "\0\u4fbc\0\u4fe6\0\u02a0\0\u5010\0\u503a\0\u5064\0\u508e\0\u50b8"+
-    "\0\u50e2\0\u510c\0\u5136\0\u5160\0\u518a\0\u51b4\0\u51de\0\u5208"+
-    "\0\u0444\0\u2ad2\0\u5232\0\u525c\0\u5286\0\u0ec4\0\u52b0\0\u52da"+
-    "\0\u08b2\0\u5304\0\u532e\0\u5358\0\u5382\0\u53ac\0\u53d6\0\u5400"+
-    "\0\u542a\0\u41a0\0\u41a0\0\u41f4\0\u5454\0\u547e\0\u41f4\0\u54a8"+
-    "\0\u54d2\0\u54fc\0\u0444\0\u2fbe\0\u5526\0\u42c6\0\u303c\0\u5550"+
-    "\0\u303c\0\u557a\0\u55a4\0\u0d20\0\u0e9a\0\u31b6\0\u55ce\0\u0d20"+
-    "\0\u31b6\0\u55f8\0\u4440\0\u5622\0\u564c\0\u02a0\0\u5676\0\u56a0"+
-    "\0\u56ca\0\u56f4\0\u571e\0\u5748\0\u5772\0\u579c\0\u57c6\0\u57f0"+
-    "\0\u581a\0\u0444\0\u357c\0\u5844\0\u586e\0\u5898\0\u58c2\0\u58ec"+
-    "\0\u5916\0\u5940\0\u596a\0\u5994\0\u59be\0\u59e8\0\u5a12\0\u5a3c"+
-    "\0\u5a66\0\u5a90\0\u5aba\0\u5ae4\0\u5b0e\0\u5b38\0\u5b62\0\u5b8c"+
-    "\0\u5bb6\0\u5be0\0\u5c0a\0\u5c34\0\u5c5e\0\u5c88\0\u5cb2\0\u5cdc"+
-    "\0\u5d06\0\u5d30\0\u5d5a\0\u5d84\0\u5dae\0\u5dd8\0\u5e02\0\u5e2c"+
-    "\0\u05be\0\u5e56\0\u5e80\0\u468c\0\u5eaa\0\u5ed4\0\u5efe\0\u5f28"+
-    "\0\u5f52\0\u5f7c\0\u5fa6\0\u5fd0\0\u5ffa\0\u6024\0\u604e\0\u6078"+
-    "\0\u60a2\0\u60cc\0\u60f6\0\u6120\0\u614a\0\u6174\0\u619e\0\u61c8"+
-    "\0\u61f2\0\u0ec4\0\u167a\0\u621c\0\u02a0\0\u6246\0\u6270\0\u629a"+
-    "\0\u62c4\0\u62ee\0\u6318\0\u6342\0\u636c\0\u6396\0\u63c0\0\u63ea"+
-    "\0\u6414\0\u643e\0\u6468\0\u6492\0\u64bc\0\u64e6\0\u6510\0\u653a"+
-    "\0\u6564\0\u658e\0\u65b8\0\u02a0\0\u65e2\0\u660c\0\u6636\0\u6660"+
-    "\0\u668a\0\u0ec4\0\u32dc\0\u66b4\0\u66de\0\u6708\0\u6732\0\u675c"+
-    "\0\u6786\0\u67b0\0\u67da\0\u6804\0\u682e\0\u6858\0\u6882\0\u68ac"+
-    "\0\u68d6\0\u6900\0\u692a\0\u6954\0\u697e\0\u69a8\0\u69d2\0\u69fc"+
-    "\0\u6a26\0\u6a50\0\u6a7a\0\u6aa4\0\u6ace\0\u6af8\0\u6b22\0\u6b4c"+
-    "\0\u6b76\0\u6ba0\0\u6bca\0\u6bf4\0\u6c1e\0\u6c48\0\u6c72\0\u6c9c"+
-    "\0\u6cc6\0\u6cf0\0\u6d1a\0\u6d44\0\u6d6e\0\u6d98\0\u6dc2\0\u6dec"+
-    "\0\u6e16\0\u6e40\0\u6e6a\0\u6e94\0\u508e\0\u6ebe\0\u6ee8\0\u6f12"+
-    "\0\u6f3c\0\u6f66\0\u6f90\0\u6fba\0\u6fe4\0\u02a0\0\u700e\0\u7038"+
-    "\0\u7062\0\u708c\0\u70b6\0\u70e0\0\u710a\0\u7134\0\u715e\0\u7188"+
-    "\0\u71b2\0\u71dc\0\u7206\0\u7230\0\u725a\0\u7284\0\u72ae\0\u72d8"+
-    "\0\u7302\0\u732c\0\u7356\0\u7380\0\u73aa\0\u73d4\0\u73fe\0\u7428"+
-    "\0\u7452\0\u747c\0\u74a6\0\u74d0\0\u74fa\0\u7524\0\u754e\0\u7578"+
-    "\0\u75a2\0\u75cc\0\u0f96\0\u063c\0\u75f6\0\u7620\0\u3480\0\u764a"+
-    "\0\u7674\0\u769e\0\u76c8\0\u76f2\0\u771c\0\u7746\0\u7770\0\u779a"+
-    "\0\u77c4\0\u77ee\0\u7818\0\u7842\0\u786c\0\u7896\0\u78c0\0\u78ea"+
-    "\0\u7914\0\u793e\0\u7968\0\u7992\0\u79bc\0\u79e6\0\u7a10\0\u7a3a"+
-    "\0\u7a64\0\u7a8e\0\u7ab8\0\u7ae2\0\u7b0c\0\u7b36\0\u614a\0\u7b60"+
-    "\0\u7b8a\0\u7bb4\0\u7bde\0\u7c08\0\u7c32\0\u7c5c\0\u7c86\0\u7cb0"+
-    "\0\u7cda\0\u7d04\0\u7d2e\0\u7d58\0\u7d82\0\u7dac\0\u7dd6\0\u7e00"+
-    "\0\u7e2a\0\u7e54\0\u7e7e\0\u7ea8\0\u7ed2\0\u7efc\0\u7f26\0\u7f50"+
-    "\0\u7f7a\0\u7fa4\0\u02a0\0\u7fce\0\u7ff8\0\u8022\0\u804c\0\u8076"+
-    "\0\u80a0\0\u80ca\0\u80f4\0\u811e\0\u8148\0\u8172\0\u819c\0\u81c6"+
-    "\0\u81f0\0\u821a\0\u8244\0\u826e\0\u8298\0\u82c2\0\u4c9e\0\u82ec"+
-    "\0\u8316\0\u8340\0\u5772\0\u75f6\0\u0f96\0\u836a\0\u8394\0\u83be"+
-    "\0\u83e8\0\u8412\0\u843c\0\u8466\0\u8490\0\u84ba\0\u84e4\0\u850e"+
-    "\0\u71b2\0\u8538\0\u8562\0\u858c\0\u85b6\0\u85e0\0\u02a0\0\u860a"+
-    "\0\u8634\0\u865e\0\u8688\0\u86b2\0\u86dc\0\u8706\0\u8730\0\u875a"+
-    "\0\u8784\0\u87ae\0\u87d8\0\u8802\0\u882c\0\u8856\0\u8880\0\u88aa"+
-    "\0\u88d4\0\u88fe\0\u508e\0\u8928\0\u8952\0\u7d58\0\u897c\0\u89a6"+
-    "\0\u89d0\0\u89fa\0\u8a24\0\u8a4e\0\u8a78\0\u8aa2\0\u89fa\0\u8acc"+
-    "\0\u8af6\0\u02a0\0\u8b20\0\u8b4a\0\u8b74\0\u02a0\0\u8b9e\0\u8bc8"+
-    "\0\u8bf2\0\u8c1c\0\u8c46\0\u8c70\0\u8c9a\0\u02a0\0\u8cc4\0\u8cee"+
-    "\0\u8d18\0\u8d42\0\u8d6c\0\u8d96\0\u8dc0\0\u8dea\0\u8e14\0\u8e3e"+
-    "\0\u8e68\0\u8e92\0\u8ebc\0\u8ee6\0\u8f10\0\u8f3a\0\u8f64\0\u8f8e"+
-    "\0\u3918\0\u8fb8\0\u8fe2\0\u900c\0\u9036\0\u47dc\0\u9060\0\u908a"+
-    "\0\u90b4\0\u90de\0\u02a0\0\u9108\0\u9132\0\u915c\0\u9186\0\u91b0"+
-    "\0\u91da\0\u9204\0\u922e\0\u9258\0\u02a0\0\u86b2\0\u9282\0\u92ac"+
-    "\0\u92d6\0\u9300\0\u932a\0\u9354\0\u937e\0\u93a8\0\u93d2\0\u0444"+
-    "\0\u93fc\0\u7968\0\u9426\0\u9450\0\u947a\0\u94a4\0\u94ce\0\u94f8"+
-    "\0\u9522\0\u954c\0\u9576\0\u95a0\0\u95ca\0\u95f4\0\u961e\0\u9648"+
-    "\0\u9672\0\u969c\0\u96c6\0\u96f0\0\u971a\0\u9744\0\u976e\0\u02a0"+
-    "\0\u9798\0\u97c2\0\u97ec\0\u9816\0\u9840\0\u986a\0\u9894\0\u98be"+
-    "\0\u98e8\0\u9912\0\u993c\0\u9966\0\u9990\0\u99ba\0\u99e4\0\u9a0e"+
-    "\0\u9a38\0\u9a62\0\u9a8c\0\u9ab6\0\u9ae0\0\u9b0a\0\u9b34\0\u9b5e"+
-    "\0\u9b88\0\u9bb2\0\u9bdc\0\u9c06\0\u9c30\0\u9c5a\0\u9c84\0\u9cae"+
-    "\0\u9cd8\0\u9d02\0\u9d2c\0\u9d56\0\u9d80\0\u9daa\0\u9dd4\0\u9dfe"+
-    "\0\u9e28\0\u9e52\0\u9e7c\0\u9ea6\0\u9ed0\0\u9efa\0\u9f24\0\u0444"+
-    "\0\u8802\0\u9f4e\0\u9f78\0\u9fa2\0\u9fcc\0\u0ec4\0\u9ff6\0\ua020"+
-    "\0\u02a0\0\ua04a\0\ua074\0\ua09e\0\ua0c8\0\ua0f2\0\ua11c\0\ua146"+
-    "\0\ua170\0\ua19a\0\ua1c4\0\ua1ee\0\ua218\0\ua242\0\ua26c\0\ua296"+
-    "\0\ua2c0\0\ua2ea\0\ua314\0\ua33e\0\ua368\0\ua392\0\ua3bc\0\ua3e6"+
-    "\0\ua410\0\ua43a\0\ua464\0\ua48e\0\ua4b8\0\ua4e2\0\ua50c\0\ua536"+
-    "\0\ua560\0\ua58a\0\ua5b4\0\ua5de\0\ua608\0\ua632\0\ua65c\0\ua686"+
-    "\0\ua6b0\0\ua6da\0\ua704\0\ua72e\0\ua758\0\ua782\0\ua7ac\0\ua7d6"+
-    "\0\ua800\0\ua82a\0\ua854\0\ua87e\0\ua8a8\0\ua8d2\0\ua8fc\0\ua926"+
-    "\0\ua950\0\ua97a\0\ua9a4\0\ua9ce\0\ua9f8\0\uaa22\0\uaa4c\0\uaa76"+
-    "\0\uaaa0\0\uaaca\0\uaaf4\0\uab1e\0\uab48\0\uab72\0\uab9c\0\uabc6"+
-    "\0\uabf0\0\uac1a\0\u0ec4\0\u7968\0\uac44\0\uac6e\0\uac98\0\uacc2"+
-    "\0\uacec\0\uad16\0\uad40\0\uad6a\0\uad94\0\uadbe\0\uade8\0\uae12"+
-    "\0\uae3c\0\uae66\0\uae90\0\uaeba\0\uaee4\0\uaf0e\0\uaf38\0\uaf62"+
-    "\0\uaf8c\0\uafb6\0\uafe0\0\ub00a\0\ub034\0\ub05e\0\ub088\0\ub0b2"+
-    "\0\ub0dc\0\ub106\0\ub130\0\ub15a\0\ub184\0\ub1ae\0\ub1d8\0\ub202"+
-    "\0\ub22c\0\ub256\0\ub280\0\ub2aa\0\ub2d4\0\ub2fe\0\ub328\0\ub352"+
-    "\0\ub37c\0\ub3a6\0\ub3d0\0\ub3fa\0\ub424\0\ub44e\0\ub478\0\ub4a2"+
-    "\0\ub4cc\0\ub4f6\0\ub520\0\ub54a\0\ub574\0\ub59e\0\ub5c8\0\ub5f2"+
-    "\0\ub61c\0\ub646\0\ub670\0\ub69a\0\ub6c4\0\ub6ee\0\ub718\0\ub742"+
-    "\0\ub76c\0\ub796\0\ub7c0\0\ub7ea\0\ub814\0\ub83e\0\ub868\0\ub892"+
-    "\0\ub8bc\0\ub8e6\0\ub910\0\ub93a\0\ub964\0\ub98e\0\ub9b8\0\ub9e2"+
-    "\0\uba0c\0\uba36\0\uba60\0\uba8a\0\ubab4\0\ubade\0\ubb08\0\ubb32"+
-    "\0\ubb5c\0\ubb86\0\ubbb0\0\ubbda\0\ubc04\0\ubc2e\0\ubc58\0\ubc82"+
-    "\0\ubcac\0\ubcd6\0\ubd00\0\ubd2a\0\ubd54\0\ubd7e\0\ubda8\0\ubdd2"+
-    "\0\ubdfc\0\ube26\0\ube50\0\ube7a\0\ubea4\0\ubece\0\ubef8\0\ubf22"+
-    "\0\ubf4c\0\ubf76\0\ubfa0\0\ubfca\0\ubff4\0\uc01e\0\uc048\0\uc072"+
-    "\0\uc09c\0\uc0c6\0\uc0f0\0\uc11a\0\uc144\0\uc16e\0\uc198\0\uc1c2"+
-    "\0\uc1ec\0\uc216\0\uc240\0\uc26a\0\uc294\0\uc2be\0\uc2e8\0\uc312"+
-    "\0\uc33c\0\uc366\0\uc390\0\uc3ba\0\uc3e4\0\uc40e\0\uc438\0\uc462"+
-    "\0\uc48c\0\uc4b6\0\uc4e0\0\uc50a\0\uc534\0\uc55e\0\uc588\0\uc5b2"+
-    "\0\uc5dc\0\uc606\0\uc630\0\uc65a\0\uc684\0\uc6ae\0\uc6d8\0\uc702"+
-    "\0\uc72c\0\uc756\0\uc780\0\uc7aa\0\ub93a\0\uc7d4\0\ub964\0\uc7fe"+
-    "\0\uc828\0\uc852\0\uc87c\0\uc8a6\0\uc8d0\0\uc8fa\0\uc924\0\uc94e"+
-    "\0\uc978\0\uc9a2\0\uc9cc\0\uc9f6\0\uca20\0\uca4a\0\uca74\0\uca9e"+
-    "\0\ucac8\0\ucaf2\0\ucb1c\0\ucb46\0\ucb70\0\ucb9a\0\ucbc4\0\ucbee"+
-    "\0\ucc18\0\ucc42\0\ucc6c\0\ucc96\0\uccc0\0\uccea\0\ucd14\0\ucd3e"+
-    "\0\ucd68\0\ucd92\0\ucdbc\0\ucde6\0\uce10\0\uce3a\0\uce64\0\uce8e"+
-    "\0\uceb8\0\ucee2\0\ucf0c\0\ucf36\0\uc33c\0\ucf60\0\ucf8a\0\ucfb4"+
-    "\0\ucfde\0\ud008\0\ud032\0\ud05c\0\ud086\0\ud0b0\0\u02a0\0\ud0da"+
-    "\0\ud104\0\ud12e\0\ud158\0\ud182\0\ud1ac\0\ud1d6\0\ud200\0\ud22a"+
-    "\0\ud254\0\ud27e\0\ud2a8\0\ud2d2\0\ud2fc\0\ud326\0\ud350\0\ud37a"+
-    "\0\ud3a4\0\ud3ce\0\ud3f8\0\ud422\0\ud44c\0\ud476\0\u02a0\0\ud4a0"+
-    "\0\ud4ca\0\ud4f4\0\ud51e\0\ud548\0\ud572\0\ud59c\0\ud5c6\0\ud5f0"+
-    "\0\ud61a\0\ud644\0\ud66e\0\ud104\0\ud698\0\ud6c2\0\ud6ec\0\ud716"+
-    "\0\ud740\0\ud76a\0\ud794\0\ud7be\0\ud7e8\0\ud812";
-
-  private static int [] zzUnpackRowMap() {
-    int [] result = new int[1494];
-    int offset = 0;
-    offset = zzUnpackRowMap(ZZ_ROWMAP_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpackRowMap(String packed, int offset, int [] result) {
-    int i = 0;  /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length() - 1;
-    while (i < l) {
-      int high = packed.charAt(i++) << 16;
-      result[j++] = high | packed.charAt(i++);
-    }
-    return j;
-  }
+  private static final int [] ZZ_ROWMAP = ScannerTables.ROWMAP;
 
   /**
    * The transition table of the DFA
    */
-  private static final int [] ZZ_TRANS = zzUnpacktrans();
-
-  private static final String ZZ_TRANS_PACKED_0 =
-    "\3\21\2\0\1\22\43\21\1\0\3\23\2\0\1\24"+
-    "\43\23\1\0\2\25\1\23\2\0\1\24\7\25\1\26"+
-    "\33\25\1\0\2\23\1\27\2\0\1\30\43\23\1\0"+
-    "\2\31\1\27\2\0\1\30\7\31\1\32\33\31\1\0"+
-    "\2\33\1\23\2\0\1\24\43\33\1\0\3\23\2\0"+
-    "\1\24\1\23\1\34\5\23\1\35\33\23\1\0\1\36"+
-    "\1\37\1\23\1\0\1\40\1\24\1\37\1\41\1\36"+
-    "\3\37\1\36\1\42\1\36\2\37\30\36\1\0\3\23"+
-    "\2\0\1\24\1\23\1\34\5\23\1\43\32\23\1\44"+
-    "\1\0\1\45\1\46\1\47\1\50\1\51\1\52\1\45"+
-    "\1\53\1\54\4\45\1\55\3\45\1\56\1\45\6\56"+
-    "\1\57\1\56\1\60\6\56\1\61\3\56\1\62\1\63"+
-    "\1\64\1\50\3\65\2\0\1\66\1\65\1\67\5\65"+
-    "\1\70\7\65\1\71\23\65\1\0\1\72\1\73\1\74"+
-    "\1\0\1\75\1\76\1\72\1\77\5\72\1\100\7\72"+
-    "\1\101\2\72\1\102\1\103\1\72\1\104\5\72\1\105"+
-    "\1\106\3\72\1\107\1\72\1\110\1\0\1\111\1\15"+
-    "\1\0\1\112\2\0\41\111\1\15\1\111\1\112\47\0"+
-    "\1\113\3\0\1\17\1\114\1\0\1\17\1\115\7\0"+
-    "\1\116\104\0\1\117\55\0\1\21\51\0\1\23\47\0"+
-    "\2\120\3\121\1\122\7\120\1\123\33\120\1\0\2\120"+
-    "\3\121\1\122\5\120\1\124\1\120\1\123\33\120\1\0"+
-    "\2\125\1\126\2\0\1\127\43\125\3\0\1\27\47\0"+
-    "\2\130\4\0\7\130\1\131\33\130\1\0\2\130\4\0"+
-    "\7\130\1\132\33\130\1\0\2\133\3\134\1\135\43\133"+
-    "\1\0\7\136\1\23\12\136\1\137\27\136\13\0\1\140"+
-    "\36\0\1\141\1\142\2\0\1\40\1\0\1\142\2\141"+
-    "\3\142\1\141\1\143\1\141\2\142\30\141\1\0\1\141"+
-    "\1\142\2\0\1\40\1\0\1\142\2\141\3\142\1\141"+
-    "\1\143\1\144\2\142\30\141\17\0\1\145\33\0\1\146"+
-    "\1\147\2\136\1\150\1\136\1\147\1\36\1\146\3\147"+
-    "\1\146\1\151\1\146\2\147\1\146\1\152\26\146\1\136"+
-    "\1\141\1\142\2\0\1\40\1\0\1\142\2\141\2\142"+
-    "\1\153\1\141\1\154\1\144\2\142\30\141\14\0\1\155"+
-    "\1\0\1\156\35\0\1\157\1\160\1\0\1\157\1\161"+
-    "\7\0\1\162\34\0\2\163\1\164\1\50\1\0\1\165"+
-    "\43\163\1\50\1\163\1\166\1\167\1\50\1\51\1\170"+
-    "\2\163\1\171\4\163\1\172\3\163\1\173\1\163\6\173"+
-    "\1\174\1\173\1\175\6\173\1\176\3\173\1\177\1\200"+
-    "\1\163\1\50\1\0\1\201\2\0\1\201\33\0\1\202"+
-    "\6\0\1\203\1\204\1\0\2\50\1\205\2\0\1\206"+
-    "\43\50\2\0\1\51\1\201\1\0\1\51\1\207\2\0"+
-    "\1\210\4\0\1\211\3\0\1\212\1\0\6\212\1\213"+
-    "\1\212\1\214\6\212\1\215\3\212\1\216\1\217\4\0"+
-    "\1\47\47\0\2\220\1\221\1\222\1\136\1\223\1\220"+
-    "\1\45\12\220\1\224\26\220\1\222\2\163\1\164\1\50"+
-    "\1\0\1\165\21\163\1\225\21\163\1\50\2\163\1\164"+
-    "\1\50\1\0\1\165\5\163\1\226\1\163\1\227\33\163"+
-    "\1\50\1\163\1\230\1\164\1\50\1\231\1\165\10\163"+
-    "\1\173\2\163\1\173\1\163\24\173\2\163\1\50\1\163"+
-    "\1\230\1\164\1\50\1\231\1\165\10\163\1\173\2\163"+
-    "\1\173\1\163\14\173\1\232\7\173\2\163\1\50\1\163"+
-    "\1\230\1\164\1\50\1\231\1\165\10\163\1\173\2\163"+
-    "\1\173\1\163\6\173\1\233\15\173\2\163\1\50\1\163"+
-    "\1\230\1\164\1\50\1\231\1\165\10\163\1\173\2\163"+
-    "\1\173\1\163\23\173\1\234\2\163\1\50\1\163\1\230"+
-    "\1\164\1\50\1\231\1\165\10\163\1\173\2\163\1\173"+
-    "\1\163\7\173\1\235\14\173\2\163\1\50\1\163\1\200"+
-    "\1\236\1\50\1\217\1\237\7\163\1\240\31\163\1\241"+
-    "\1\163\1\50\1\163\1\242\1\243\1\50\1\157\1\244"+
-    "\7\163\1\245\33\163\1\50\2\0\1\65\110\0\1\246"+
-    "\10\0\2\247\1\250\2\0\1\251\43\247\1\0\1\247"+
-    "\1\252\1\250\1\0\1\75\1\251\22\247\1\253\1\254"+
-    "\1\247\1\255\5\247\1\256\1\257\3\247\1\260\1\247"+
-    "\1\110\2\0\1\261\2\0\1\261\3\0\1\262\10\0"+
-    "\1\263\1\0\24\263\1\264\2\0\1\265\1\75\1\266"+
-    "\1\0\1\75\1\267\22\265\1\270\1\271\1\265\1\272"+
-    "\5\265\1\273\1\274\3\265\1\275\1\265\1\276\3\0"+
-    "\1\74\47\0\2\277\1\300\2\136\1\301\1\277\1\302"+
-    "\12\277\1\303\26\277\1\136\2\247\1\250\2\0\1\251"+
-    "\5\247\1\304\1\247\1\305\33\247\1\0\2\247\1\250"+
-    "\2\0\1\251\33\247\1\306\7\247\1\0\2\247\1\250"+
-    "\2\0\1\251\27\247\1\307\13\247\1\0\2\247\1\250"+
-    "\2\0\1\251\31\247\1\310\11\247\1\0\2\247\1\250"+
-    "\2\0\1\251\23\247\1\311\17\247\1\0\2\247\1\250"+
-    "\2\0\1\251\22\247\1\312\20\247\1\0\2\247\1\250"+
-    "\2\0\1\251\40\247\1\313\2\247\1\0\2\247\1\250"+
-    "\2\0\1\251\24\247\1\314\16\247\1\0\2\111\1\114"+
-    "\1\112\1\0\1\115\43\111\3\112\1\114\2\0\1\115"+
-    "\43\112\2\0\1\113\1\315\1\0\1\113\47\0\1\114"+
-    "\62\0\1\316\1\0\1\112\35\0\1\117\2\0\1\117"+
-    "\47\0\1\317\47\0\2\124\1\320\2\321\1\322\5\124"+
-    "\1\323\1\124\1\324\33\124\1\325\2\126\4\0\41\126"+
-    "\1\326\1\126\3\0\1\126\47\0\2\132\3\327\1\330"+
-    "\43\132\3\0\1\331\47\0\7\136\1\34\12\136\1\137"+
-    "\27\136\13\140\1\332\36\140\1\141\1\142\2\0\1\40"+
-    "\1\0\1\142\2\141\3\142\1\141\1\154\1\144\2\142"+
-    "\30\141\1\0\1\141\1\333\2\0\1\334\1\0\1\333"+
-    "\2\141\3\333\1\335\1\336\1\144\2\333\30\141\2\0"+
-    "\1\337\2\0\1\337\1\0\1\337\2\0\3\337\1\340"+
-    "\1\337\1\145\2\337\31\0\1\146\1\147\2\136\1\150"+
-    "\1\136\1\147\1\36\1\146\3\147\1\146\1\151\1\341"+
-    "\2\147\1\146\1\152\26\146\10\136\1\23\6\136\1\342"+
-    "\3\136\1\137\27\136\1\146\1\147\2\136\1\150\1\136"+
-    "\1\147\1\36\1\146\3\147\1\146\1\343\1\341\2\147"+
-    "\1\146\1\152\26\146\1\136\1\146\1\147\2\136\1\150"+
-    "\1\136\1\147\1\41\1\146\3\147\1\146\1\151\1\146"+
-    "\2\147\1\146\1\152\26\146\1\136\1\344\1\153\2\140"+
-    "\1\345\1\140\1\153\2\344\2\153\1\346\1\344\1\347"+
-    "\1\350\2\153\30\344\1\140\1\351\1\154\2\352\1\353"+
-    "\1\354\1\154\2\351\3\154\1\351\1\154\1\355\2\154"+
-    "\30\351\1\0\13\155\1\356\36\155\2\156\3\352\1\354"+
-    "\43\156\1\0\2\160\3\357\1\360\43\160\3\0\1\160"+
-    "\62\0\1\361\1\0\1\362\35\0\1\205\2\0\1\205"+
-    "\24\0\1\363\1\0\1\364\4\0\1\202\1\0\1\365"+
-    "\3\0\1\366\5\0\1\164\51\0\1\167\47\0\2\163"+
-    "\1\164\1\50\1\0\1\165\5\163\1\367\1\163\1\370"+
-    "\33\163\1\50\1\0\1\201\2\0\1\201\42\0\1\203"+
-    "\1\204\42\0\1\371\2\0\1\372\6\0\1\205\2\0"+
-    "\1\205\24\0\1\363\1\0\1\364\6\0\1\365\3\0"+
-    "\1\366\5\0\1\205\51\0\1\201\76\0\1\373\35\0"+
-    "\1\374\1\0\1\375\35\0\1\231\2\0\1\231\11\0"+
-    "\1\212\2\0\1\212\1\0\24\212\4\0\1\231\2\0"+
-    "\1\231\11\0\1\212\2\0\1\212\1\0\14\212\1\376"+
-    "\7\212\4\0\1\231\2\0\1\231\11\0\1\212\2\0"+
-    "\1\212\1\0\6\212\1\377\15\212\4\0\1\231\2\0"+
-    "\1\231\11\0\1\212\2\0\1\212\1\0\23\212\1\u0100"+
-    "\4\0\1\231\2\0\1\231\11\0\1\212\2\0\1\212"+
-    "\1\0\7\212\1\u0101\14\212\4\0\1\217\1\u0102\1\0"+
-    "\1\217\1\u0103\7\0\1\u0104\34\0\1\136\1\u0105\2\136"+
-    "\1\u0105\2\136\1\23\12\136\1\137\6\136\1\u0106\1\136"+
-    "\1\u0107\4\136\1\u0108\1\136\1\u0109\3\136\1\u010a\3\136"+
-    "\2\222\1\u0105\2\136\1\u010b\1\222\1\u010c\12\222\1\u010d"+
-    "\26\222\3\136\1\221\4\136\1\23\12\136\1\137\27\136"+
-    "\2\220\1\221\1\222\1\136\1\223\1\220\1\53\12\220"+
-    "\1\224\26\220\1\222\2\163\1\164\1\50\1\0\1\165"+
-    "\22\163\1\u010e\20\163\1\50\2\226\1\u010f\1\u0110\1\155"+
-    "\1\u0111\5\226\1\u0112\35\226\1\u0110\2\227\1\u0113\1\u0114"+
-    "\1\352\1\u0115\43\227\1\50\1\163\1\230\1\164\1\50"+
-    "\1\231\1\165\2\163\1\u0116\10\163\1\u0117\1\163\24\u0117"+
-    "\2\163\1\50\1\0\1\231\2\0\1\231\3\0\1\u0118"+
-    "\10\0\1\u0119\1\0\24\u0119\3\0\1\163\1\230\1\164"+
-    "\1\50\1\231\1\165\10\163\1\173\2\163\1\173\1\163"+
-    "\16\173\1\u011a\5\173\2\163\1\50\1\163\1\u011b\1\164"+
-    "\1\50\1\u011c\1\165\3\163\1\u011d\4\163\1\173\2\163"+
-    "\1\173\1\163\24\173\2\163\1\50\1\163\1\230\1\164"+
-    "\1\50\1\231\1\165\10\163\1\173\2\163\1\173\1\163"+
-    "\10\173\1\u011e\13\173\2\163\1\50\1\163\1\230\1\164"+
-    "\1\50\1\231\1\165\10\163\1\173\2\163\1\173\1\163"+
-    "\10\173\1\u011f\13\173\2\163\1\50\1\0\1\u0102\1\u0120"+
-    "\1\0\1\u0102\1\u0121\7\0\1\u0122\22\0\1\202\13\0"+
-    "\1\236\47\0\2\163\1\164\1\50\1\0\1\165\5\163"+
-    "\1\u0123\1\163\1\u0124\33\163\1\50\1\163\1\241\1\u0125"+
-    "\1\50\1\0\1\u0126\41\163\1\241\1\163\1\50\1\160"+
-    "\1\u0127\2\357\1\u0128\1\360\23\160\1\u0129\1\160\1\u012a"+
-    "\4\160\1\u012b\1\160\1\u012c\3\160\1\u012d\2\160\3\0"+
-    "\1\243\47\0\2\163\1\164\1\50\1\0\1\165\5\163"+
-    "\1\u012e\1\163\1\u012f\33\163\1\50\30\0\1\u0130\23\0"+
-    "\1\250\50\0\1\u0131\2\0\1\u0131\42\0\1\264\31\0"+
-    "\1\u0132\23\0\1\u0133\2\0\1\u0133\11\0\1\263\2\0"+
-    "\1\263\1\0\24\263\3\0\2\264\3\u0134\1\u0135\43\264"+
-    "\1\0\2\265\1\266\2\0\1\267\43\265\2\0\1\266"+
-    "\2\0\1\266\42\0\1\264\4\0\1\266\47\0\2\265"+
-    "\1\266\2\0\1\267\27\265\1\u0136\13\265\1\0\2\265"+
-    "\1\266\2\0\1\267\31\265\1\u0137\11\265\1\0\2\265"+
-    "\1\266\2\0\1\267\23\265\1\u0138\17\265\1\0\2\265"+
-    "\1\266\2\0\1\267\22\265\1\u0139\20\265\1\0\2\265"+
-    "\1\266\2\0\1\267\40\265\1\u013a\2\265\1\0\2\265"+
-    "\1\266\2\0\1\267\24\265\1\u013b\16\265\1\0\1\136"+
-    "\1\u013c\2\136\1\u013c\2\136\1\23\1\u013d\10\136\1\u013e"+
-    "\1\137\24\u013e\1\u013f\4\136\1\300\4\136\1\23\12\136"+
-    "\1\137\27\136\2\277\1\300\2\136\1\301\1\277\1\u0140"+
-    "\12\277\1\303\26\277\1\136\2\304\1\u0141\2\155\1\u0142"+
-    "\5\304\1\u0143\35\304\1\155\2\305\1\u0144\2\352\1\u0145"+
-    "\43\305\1\0\2\247\1\250\2\0\1\251\22\247\1\u0146"+
-    "\20\247\1\0\2\247\1\250\2\0\1\251\34\247\1\u0147"+
-    "\6\247\1\0\2\247\1\250\2\0\1\251\33\247\1\u0148"+
-    "\7\247\1\0\1\247\1\311\1\250\1\0\1\u0138\1\251"+
-    "\43\247\1\0\2\247\1\250\2\0\1\251\35\247\1\u0149"+
-    "\5\247\1\0\2\247\1\250\2\0\1\251\25\247\1\u014a"+
-    "\15\247\1\0\2\247\1\250\2\0\1\251\25\247\1\u014b"+
-    "\15\247\1\0\2\u014c\3\0\23\u014c\1\u014d\1\u014e\1\u014f"+
-    "\6\u014c\1\u0150\7\u014c\1\0\2\316\4\0\5\316\1\u0151"+
-    "\35\316\1\0\1\325\1\u0152\2\325\1\u0152\6\325\1\u0153"+
-    "\51\325\1\u0154\40\325\1\u0155\10\325\1\u0154\36\325\2\124"+
-    "\1\320\2\321\1\322\5\124\1\323\1\124\1\u0156\33\124"+
-    "\1\325\2\124\1\320\2\321\1\322\5\124\1\u0157\1\124"+
-    "\1\324\33\124\1\325\2\326\1\u0158\3\u0159\42\326\1\126"+
-    "\1\u0159\2\0\1\u015a\47\0\13\140\1\332\1\140\1\23"+
-    "\34\140\1\u015b\1\333\2\u015c\1\u015d\1\u015e\1\333\2\u015b"+
-    "\3\333\1\u015b\1\336\1\u015f\2\333\30\u015b\1\0\2\337"+
-    "\3\u015c\1\u015e\10\337\1\u0160\32\337\1\0\1\141\1\142"+
-    "\2\0\1\40\1\0\1\142\2\141\3\142\1\141\1\143"+
-    "\1\u0161\2\142\30\141\1\0\1\u015b\1\333\2\u015c\1\u015d"+
-    "\1\u015e\1\333\2\u015b\3\333\1\u015b\1\154\1\u015f\2\333"+
-    "\30\u015b\1\0\2\337\3\u015c\1\u015e\43\337\17\0\1\u0162"+
-    "\33\0\1\146\1\u0163\2\136\1\u0164\1\136\1\u0163\1\36"+
-    "\1\146\3\u0163\1\u0165\1\u0166\1\341\2\u0163\1\146\1\152"+
-    "\26\146\2\136\1\u0167\2\136\1\u0167\1\136\1\u0167\1\23"+
-    "\1\136\3\u0167\1\u0168\1\u0167\1\342\2\u0167\1\136\1\137"+
-    "\27\136\1\u0169\1\343\2\u016a\1\u016b\1\u016c\1\343\1\u016d"+
-    "\1\u0169\3\343\1\u0169\1\343\1\u016e\2\343\1\u0169\1\u016f"+
-    "\26\u0169\1\136\1\344\1\153\2\140\1\345\1\140\1\153"+
-    "\2\344\2\153\1\346\1\344\1\347\1\344\2\153\30\344"+
-    "\14\140\1\332\2\140\1\u0170\33\140\1\344\1\153\2\140"+
-    "\1\345\1\140\1\153\2\344\2\153\1\346\1\344\1\u0171"+
-    "\1\350\2\153\30\344\1\140\1\344\1\153\2\140\1\345"+
-    "\1\140\1\153\2\344\2\153\1\346\1\344\1\u0172\1\350"+
-    "\2\153\30\344\1\140\1\344\1\u0173\2\140\1\u0174\1\140"+
-    "\1\u0173\2\344\2\u0173\1\u0175\1\u0176\1\u0177\1\350\2\u0173"+
-    "\30\344\1\140\1\351\1\154\2\352\1\353\1\354\1\154"+
-    "\2\351\3\154\1\351\1\154\1\351\2\154\30\351\3\0"+
-    "\1\u0178\47\0\1\351\1\154\2\352\1\u0179\1\354\1\154"+
-    "\2\351\3\154\1\u017a\1\154\1\355\2\154\30\351\1\0"+
-    "\13\155\1\356\1\155\1\u017b\34\155\2\0\1\u017c\47\0"+
-    "\2\361\4\0\5\361\1\u017d\35\361\1\0\2\362\1\160"+
-    "\2\0\1\161\43\362\40\0\1\u017e\43\0\1\u017f\66\0"+
-    "\1\u0180\35\0\1\u0181\17\0\2\367\1\164\1\50\1\0"+
-    "\1\165\5\367\1\u0182\35\367\1\50\2\370\1\u0183\1\50"+
-    "\1\0\1\u0184\43\370\1\50\33\0\1\u0185\43\0\1\u0186"+
-    "\54\0\1\u0187\21\0\2\374\4\0\5\374\1\u0188\35\374"+
-    "\1\0\2\375\1\201\2\0\1\207\43\375\2\0\1\231"+
-    "\2\0\1\231\11\0\1\212\2\0\1\212\1\0\16\212"+
-    "\1\u0189\5\212\4\0\1\u011c\2\0\1\u011c\4\0\1\u018a"+
-    "\4\0\1\212\2\0\1\212\1\0\24\212\4\0\1\231"+
-    "\2\0\1\231\11\0\1\212\2\0\1\212\1\0\10\212"+
-    "\1\u018b\13\212\4\0\1\231\2\0\1\231\11\0\1\212"+
-    "\2\0\1\212\1\0\10\212\1\u018c\13\212\4\0\1\u0102"+
-    "\1\u0120\1\0\1\u0102\1\u0121\7\0\1\u0122\36\0\1\u0102"+
-    "\62\0\1\u018d\1\0\1\u018e\34\0\1\136\1\u0105\2\136"+
-    "\1\u0105\2\136\1\23\12\136\1\137\6\136\1\u0106\1\136"+
-    "\1\u0107\6\136\1\u0109\3\136\1\u010a\12\136\1\23\12\136"+
-    "\1\137\14\136\1\u018f\21\136\1\23\12\136\1\137\6\136"+
-    "\1\u0190\27\136\1\23\12\136\1\137\16\136\1\u0191\2\136"+
-    "\1\u0192\14\136\1\23\12\136\1\137\23\136\1\u0193\12\136"+
-    "\1\23\12\136\1\137\7\136\1\u0194\21\136\1\u0105\4\136"+
-    "\1\23\12\136\1\137\27\136\2\222\1\u0105\2\136\1\u010b"+
-    "\1\222\1\u0195\12\222\1\u010d\26\222\1\136\2\163\1\164"+
-    "\1\50\1\0\1\165\23\163\1\u0196\17\163\1\50\1\155"+
-    "\1\u0197\2\155\1\u0197\6\155\1\356\15\155\1\u0198\1\155"+
-    "\1\u0199\4\155\1\u019a\1\155\1\u019b\3\155\1\u019c\3\155"+
-    "\2\u0110\1\u0197\2\155\1\u019d\5\u0110\1\u019e\35\u0110\3\155"+
-    "\1\u010f\10\155\1\356\36\155\2\226\1\u010f\1\u0110\1\155"+
-    "\1\u0111\5\226\1\u0112\1\226\1\u019f\33\226\1\u0110\1\0"+
-    "\1\u01a0\2\0\1\u01a0\24\0\1\363\1\0\1\364\4\0"+
-    "\1\202\1\0\1\365\3\0\1\366\1\203\1\204\3\0"+
-    "\1\u01a1\47\0\2\163\1\164\1\50\1\0\1\165\21\163"+
-    "\1\u01a2\21\163\1\50\1\163\1\u01a3\1\164\1\50\1\u01a4"+
-    "\1\165\10\163\1\u0117\1\u01a5\1\163\1\u0117\1\163\24\u0117"+
-    "\2\163\1\50\27\0\1\u01a6\23\0\1\u01a4\2\0\1\u01a4"+
-    "\11\0\1\u0119\1\u01a7\1\0\1\u0119\1\0\24\u0119\3\0"+
-    "\1\163\1\u01a8\1\164\1\50\1\u01a9\1\165\3\163\1\u01aa"+
-    "\4\163\1\173\2\163\1\173\1\163\24\173\2\163\1\50"+
-    "\1\163\1\u011b\1\164\1\50\1\u011c\1\165\2\163\1\u0116"+
-    "\1\u011d\7\163\1\u0117\1\163\24\u0117\2\163\1\50\1\0"+
-    "\1\u011c\2\0\1\u011c\3\0\1\u0118\1\u018a\7\0\1\u0119"+
-    "\1\0\24\u0119\3\0\2\u01ab\1\u01ac\1\u01ad\1\u01ae\1\u01af"+
-    "\4\u01ab\1\u01b0\36\u01ab\1\u01ad\1\163\1\230\1\164\1\50"+
-    "\1\231\1\165\10\163\1\173\2\163\1\173\1\163\20\173"+
-    "\1\u01b1\3\173\2\163\1\50\1\163\1\230\1\164\1\50"+
-    "\1\231\1\165\10\163\1\173\2\163\1\173\1\163\12\173"+
-    "\1\u01b2\11\173\2\163\1\50\2\0\1\u0120\62\0\1\u01b3"+
-    "\1\0\1\u01b4\34\0\2\u0123\1\164\1\50\1\0\1\165"+
-    "\5\u0123\1\u01b5\35\u0123\1\50\2\u0124\1\u01b6\1\50\1\0"+
-    "\1\u01b7\43\u0124\1\50\40\0\1\202\13\0\1\u0125\47\0"+
-    "\1\160\1\u0127\2\357\1\u0128\1\360\23\160\1\u0129\1\160"+
-    "\1\u012a\6\160\1\u012c\3\160\1\u012d\2\160\1\0\2\160"+
-    "\3\357\1\360\31\160\1\u01b8\11\160\1\0\2\160\3\357"+
-    "\1\360\23\160\1\u01b9\17\160\1\0\2\160\3\357\1\360"+
-    "\33\160\1\u01ba\2\160\1\u01bb\4\160\1\0\2\160\3\357"+
-    "\1\360\40\160\1\u01bc\2\160\1\0\2\160\3\357\1\360"+
-    "\24\160\1\u01bd\16\160\1\0\2\u012e\1\164\1\50\1\0"+
-    "\1\165\5\u012e\1\u01be\35\u012e\1\50\2\u012f\1\243\1\50"+
-    "\1\0\1\244\43\u012f\1\50\24\0\1\u01bf\26\0\1\u01c0"+
-    "\2\0\1\u01c0\42\0\1\264\32\0\1\u01c1\22\0\1\u0133"+
-    "\2\0\1\u0133\3\0\1\u01c2\10\0\1\u01c3\1\0\24\u01c3"+
-    "\5\0\1\u01c4\47\0\2\265\1\266\2\0\1\267\34\265"+
-    "\1\u01c5\6\265\1\0\2\265\1\266\2\0\1\267\33\265"+
-    "\1\u01c6\7\265\1\0\1\265\1\u0138\1\266\1\0\1\u0138"+
-    "\1\267\43\265\1\0\2\265\1\266\2\0\1\267\35\265"+
-    "\1\u01c7\5\265\1\0\2\265\1\266\2\0\1\267\25\265"+
-    "\1\u01c8\15\265\1\0\2\265\1\266\2\0\1\267\25\265"+
-    "\1\u01c9\15\265\1\0\1\136\1\u01ca\2\136\1\u01ca\2\136"+
-    "\1\23\12\136\1\137\24\136\1\u013f\11\136\1\23\12\136"+
-    "\1\137\4\136\1\u01cb\23\136\1\u01cc\2\136\1\u01cc\2\136"+
-    "\1\23\6\136\1\u013e\2\136\1\u013e\1\137\24\u013e\3\136"+
-    "\2\u013f\3\u01cd\1\u01ce\1\u013f\1\u01cf\12\u013f\1\u01d0\26\u013f"+
-    "\1\136\1\155\1\u01d1\2\155\1\u01d1\3\155\1\u01d2\2\155"+
-    "\1\356\5\155\1\u01d3\1\155\24\u01d3\1\u01d4\4\155\1\u0141"+
-    "\10\155\1\356\36\155\2\304\1\u0141\2\155\1\u0142\5\304"+
-    "\1\u0143\1\304\1\u01d5\33\304\1\155\2\0\1\u01d6\47\0"+
-    "\2\247\1\250\2\0\1\251\16\247\1\u01d7\24\247\1\0"+
-    "\2\247\1\250\2\0\1\251\22\247\1\311\20\247\1\0"+
-    "\2\u0148\1\u01d8\2\0\1\u01d9\43\u0148\1\0\2\247\1\250"+
-    "\2\0\1\251\36\247\1\u01da\4\247\1\0\2\247\1\250"+
-    "\2\0\1\251\35\247\1\u01db\5\247\1\0\2\247\1\250"+
-    "\2\0\1\251\27\247\1\u01dc\13\247\1\0\2\u014c\4\0"+
-    "\22\u014c\1\u014d\1\u014e\1\u014f\6\u014c\1\u0150\7\u014c\1\0"+
-    "\2\u014c\4\0\22\u014c\1\u014d\1\u014e\1\u014f\2\u014c\1\u01dd"+
-    "\3\u014c\1\u0150\7\u014c\1\0\2\u014c\4\0\22\u014c\1\u014d"+
-    "\1\u014e\1\u014f\1\u01de\5\u014c\1\u0150\7\u014c\1\0\2\u014c"+
-    "\4\0\20\u014c\1\u01df\1\u014c\1\u014d\1\u014e\1\u014f\6\u014c"+
-    "\1\u0150\7\u014c\1\0\2\u014c\4\0\22\u014c\1\u014d\1\u014e"+
-    "\1\u014f\4\u014c\1\u01e0\1\u014c\1\u0150\7\u014c\1\0\2\316"+
-    "\4\0\5\316\1\u0151\1\316\1\u01e1\33\316\1\0\2\u01e2"+
-    "\1\u0152\2\325\1\u01e3\5\u01e2\1\u01e4\1\u01e2\1\u01e5\33\u01e2"+
-    "\14\325\1\u0154\1\325\1\u01e6\34\325\2\u01e7\1\u01e8\2\121"+
-    "\1\u01e9\5\u01e7\1\124\1\u01e7\1\u01ea\33\u01e7\1\0\2\124"+
-    "\1\320\2\321\1\322\5\124\1\323\1\124\1\u01eb\33\124"+
-    "\1\325\2\u0158\1\u01ec\45\u0158\1\0\1\u0158\2\u0159\1\u0158"+
-    "\45\u0159\1\0\1\u0159\1\u015b\1\333\2\u015c\1\u015d\1\u015e"+
-    "\1\333\2\u015b\3\333\1\u015b\1\336\1\u015b\2\333\30\u015b"+
-    "\3\0\1\u01ed\47\0\1\u015b\1\333\2\u015c\1\u01ee\1\u015e"+
-    "\1\333\2\u015b\3\333\1\u01ef\1\336\1\u015f\2\333\30\u015b"+
-    "\1\0\2\337\2\u015c\1\u01f0\1\u015e\6\337\1\u01f1\1\337"+
-    "\1\u0160\32\337\1\0\1\141\1\333\2\0\1\334\1\0"+
-    "\1\333\2\141\3\333\1\141\1\336\1\u0161\2\333\30\141"+
-    "\2\0\1\337\2\0\1\337\1\0\1\337\2\0\3\337"+
-    "\1\0\1\337\1\u0162\2\337\31\0\1\u01f2\1\u0163\2\u01f3"+
-    "\1\u01f4\1\u01f5\1\u0163\1\u01f6\1\u01f2\3\u0163\1\u01f2\1\u0166"+
-    "\1\u01f7\2\u0163\1\u01f2\1\u01f8\26\u01f2\1\136\2\u0167\3\u01f3"+
-    "\1\u01f5\1\u0167\1\u01f9\6\u0167\1\u01fa\3\u0167\1\u01fb\26\u0167"+
-    "\1\136\1\146\1\147\2\136\1\150\1\136\1\147\1\36"+
-    "\1\146\3\147\1\146\1\151\1\u01fc\2\147\1\146\1\152"+
-    "\26\146\1\136\1\u01f2\1\u0163\2\u01f3\1\u01f4\1\u01f5\1\u0163"+
-    "\1\u01f6\1\u01f2\3\u0163\1\u01f2\1\343\1\u01f7\2\u0163\1\u01f2"+
-    "\1\u01f8\26\u01f2\1\136\2\u0167\3\u01f3\1\u01f5\1\u0167\1\u01f9"+
-    "\12\u0167\1\u01fb\26\u0167\10\136\1\23\6\136\1\u01fd\3\136"+
-    "\1\137\27\136\1\u0169\1\343\2\u016a\1\u016b\1\u016c\1\343"+
-    "\1\u016d\1\u0169\3\343\1\u0169\1\343\1\u0169\2\343\1\u0169"+
-    "\1\u016f\26\u0169\3\136\1\u01fe\4\136\1\23\12\136\1\137"+
-    "\27\136\1\u0169\1\343\2\u016a\1\u01ff\1\u016c\1\343\1\u016d"+
-    "\1\u0169\3\343\1\u0200\1\343\1\u016e\2\343\1\u0169\1\u016f"+
-    "\26\u0169\1\136\1\u0169\1\343\2\u016a\1\u016b\1\u016c\1\343"+
-    "\1\u0201\1\u0169\3\343\1\u0169\1\343\1\u0169\2\343\1\u0169"+
-    "\1\u016f\26\u0169\1\136\1\140\1\u0202\2\140\1\u0202\1\140"+
-    "\1\u0202\2\140\2\u0202\1\u0203\1\u0204\1\u0202\1\u0170\2\u0202"+
-    "\31\140\1\u0205\1\u0172\2\u0206\1\u0207\1\u0208\1\u0172\2\u0205"+
-    "\2\u0172\1\u0209\1\u0205\1\u0172\1\u020a\2\u0172\30\u0205\1\140"+
-    "\1\u020b\1\u0173\2\u020c\1\u020d\1\u020e\1\u0173\2\u020b\2\u0173"+
-    "\1\u0175\1\u020b\1\u0177\1\u020f\2\u0173\30\u020b\1\140\2\u0202"+
-    "\3\u020c\1\u020e\5\u0202\1\u0203\2\u0202\1\u0210\32\u0202\1\140"+
-    "\1\u020b\1\u0173\2\u020c\1\u020d\1\u020e\1\u0173\2\u020b\2\u0173"+
-    "\1\u0175\1\u020b\1\u0211\1\u020f\2\u0173\30\u020b\1\140\1\344"+
-    "\1\153\2\140\1\345\1\140\1\153\2\344\2\153\1\346"+
-    "\1\344\1\347\1\u0212\2\153\30\344\1\140\1\u020b\1\u0173"+
-    "\2\u020c\1\u020d\1\u020e\1\u0173\2\u020b\2\u0173\1\u0175\1\u020b"+
-    "\1\u0172\1\u020f\2\u0173\30\u020b\1\140\1\351\1\154\2\352"+
-    "\1\353\1\354\1\154\2\351\3\154\1\351\1\154\1\u0213"+
-    "\2\154\30\351\1\0\2\361\4\0\5\361\1\u017d\1\361"+
-    "\1\u0214\33\361\42\0\1\u017f\10\0\2\u017f\1\u0215\2\0"+
-    "\1\u0216\43\u017f\34\0\1\u0217\51\0\1\u0218\16\0\2\367"+
-    "\1\164\1\50\1\0\1\165\5\367\1\u0182\1\367\1\u0219"+
-    "\33\367\1\50\2\0\1\u0183\114\0\1\u021a\41\0\1\u021b"+
-    "\45\0\1\u021c\20\0\2\374\4\0\5\374\1\u0188\1\374"+
-    "\1\u021d\33\374\2\0\1\u01a9\2\0\1\u01a9\4\0\1\u021e"+
-    "\4\0\1\212\2\0\1\212\1\0\24\212\3\0\12\u01ae"+
-    "\1\u021f\37\u01ae\1\0\1\231\2\0\1\231\11\0\1\212"+
-    "\2\0\1\212\1\0\20\212\1\u0220\3\212\4\0\1\231"+
-    "\2\0\1\231\11\0\1\212\2\0\1\212\1\0\12\212"+
-    "\1\u0221\11\212\3\0\2\u018d\4\0\5\u018d\1\u0222\35\u018d"+
-    "\1\0\2\u018e\1\u0102\2\0\1\u0103\43\u018e\1\0\7\136"+
-    "\1\23\12\136\1\137\16\136\1\u0190\10\136\2\u0190\1\u0223"+
-    "\2\136\1\u0224\1\u0190\1\u0225\12\u0190\1\u0226\26\u0190\10\136"+
-    "\1\23\12\136\1\137\10\136\1\u0227\25\136\1\23\12\136"+
-    "\1\137\2\136\1\u0228\33\136\1\23\12\136\1\137\10\136"+
-    "\1\u0229\25\136\1\23\12\136\1\137\10\136\1\u022a\16\136"+
-    "\2\163\1\164\1\50\1\0\1\165\25\163\1\u022b\15\163"+
-    "\1\50\1\155\1\u0197\2\155\1\u0197\6\155\1\356\15\155"+
-    "\1\u0198\1\155\1\u0199\6\155\1\u019b\3\155\1\u019c\16\155"+
-    "\1\356\23\155\1\u022c\25\155\1\356\15\155\1\u022d\33\155"+
-    "\1\356\25\155\1\u022e\2\155\1\u022f\20\155\1\356\32\155"+
-    "\1\u0230\16\155\1\356\16\155\1\u0231\21\155\1\u0197\10\155"+
-    "\1\356\36\155\2\u0110\1\u0197\2\155\1\u019d\5\u0110\1\u019e"+
-    "\1\u0110\1\u0232\33\u0110\1\155\1\367\1\u0219\1\u0183\1\50"+
-    "\1\u0233\1\u0184\5\367\1\u0182\1\367\1\u0234\33\367\1\50"+
-    "\1\0\1\u01a0\2\0\1\u01a0\24\0\1\363\1\0\1\364"+
-    "\6\0\1\365\3\0\1\366\1\203\1\204\1\0\2\163"+
-    "\1\164\1\50\1\0\1\165\22\163\1\u0235\20\163\1\50"+
-    "\1\163\1\u01a3\1\164\1\50\1\u01a4\1\165\2\163\1\u0236"+
-    "\7\163\1\u01a5\1\u0237\1\163\24\u0237\2\163\1\50\1\0"+
-    "\1\u01a4\2\0\1\u01a4\3\0\1\u0238\7\0\1\u01a7\1\u0239"+
-    "\1\0\24\u0239\33\0\1\u023a\21\0\1\163\1\u01a8\1\164"+
-    "\1\50\1\u01a9\1\165\2\163\1\u0116\1\u023b\7\163\1\u0117"+
-    "\1\163\24\u0117\2\163\1\50\1\0\1\u01a9\2\0\1\u01a9"+
-    "\3\0\1\u0118\1\u023c\7\0\1\u0119\1\0\24\u0119\3\0"+
-    "\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\31\u01aa"+
-    "\1\50\1\u01ae\1\u023e\2\u01ae\1\u023e\5\u01ae\1\u021f\16\u01ae"+
-    "\1\u023f\1\u01ae\1\u0240\4\u01ae\1\u0241\1\u01ae\1\u0242\3\u01ae"+
-    "\1\u0243\3\u01ae\2\u01ad\1\u023e\2\u01ae\1\u0244\4\u01ad\1\u0245"+
-    "\36\u01ad\3\u01ae\1\u01ac\7\u01ae\1\u021f\37\u01ae\2\u01b0\1\164"+
-    "\1\50\1\0\1\165\11\u01b0\1\u0246\31\u01b0\1\50\1\163"+
-    "\1\230\1\164\1\50\1\231\1\165\10\163\1\173\2\163"+
-    "\1\173\1\163\3\173\1\u0247\20\173\2\163\1\50\1\163"+
-    "\1\230\1\164\1\50\1\231\1\165\10\163\1\173\2\163"+
-    "\1\173\1\163\5\173\1\u0248\16\173\2\163\1\50\2\u01b3"+
-    "\4\0\5\u01b3\1\u0249\35\u01b3\1\0\2\u01b4\1\u0120\2\0"+
-    "\1\u0121\43\u01b4\1\0\2\u0123\1\164\1\50\1\0\1\165"+
-    "\5\u0123\1\u01b5\1\u0123\1\u024a\33\u0123\1\50\1\0\1\u024b"+
-    "\1\u0120\1\0\1\u024b\1\u0121\7\0\1\u0122\13\0\1\363"+
-    "\1\0\1\364\4\0\1\202\1\0\1\365\3\0\1\366"+
-    "\5\0\1\u01b6\47\0\2\160\3\357\1\360\33\160\1\u01b9"+
-    "\7\160\1\0\2\u01b9\1\u024c\2\357\1\u024d\43\u01b9\1\0"+
-    "\2\160\3\357\1\360\25\160\1\u024e\15\160\1\0\2\160"+
-    "\3\357\1\360\17\160\1\u024f\23\160\1\0\2\160\3\357"+
-    "\1\360\25\160\1\u0250\15\160\1\0\2\160\3\357\1\360"+
-    "\25\160\1\u0251\15\160\1\0\2\u012e\1\164\1\50\1\0"+
-    "\1\165\5\u012e\1\u01be\1\u012e\1\u0252\33\u012e\1\50\34\0"+
-    "\1\u0253\16\0\1\266\2\0\1\266\3\0\1\262\10\0"+
-    "\1\263\1\0\24\263\1\264\33\0\1\u0254\47\0\1\u0255"+
-    "\23\0\1\u0256\2\0\1\u0256\4\0\1\u0257\4\0\1\u01c3"+
-    "\2\0\1\u01c3\1\0\24\u01c3\3\0\2\265\1\266\2\0"+
-    "\1\267\22\265\1\u0138\20\265\1\0\2\u01c6\1\u0258\2\0"+
-    "\1\u0259\43\u01c6\1\0\2\265\1\266\2\0\1\267\36\265"+
-    "\1\u025a\4\265\1\0\2\265\1\266\2\0\1\267\35\265"+
-    "\1\u025b\5\265\1\0\2\265\1\266\2\0\1\267\27\265"+
-    "\1\u025c\13\265\1\0\1\136\1\u025d\2\136\1\u025d\2\136"+
-    "\1\23\12\136\1\137\24\136\1\u013f\11\136\1\23\12\136"+
-    "\1\137\5\136\1\u025e\22\136\1\u01cc\2\136\1\u01cc\2\136"+
-    "\1\23\1\u025f\10\136\1\u0260\1\137\24\u0260\5\136\1\u0261"+
-    "\4\136\1\23\12\136\1\137\27\136\2\u013f\3\u01cd\1\u01ce"+
-    "\1\u013f\1\u0262\12\u013f\1\u01d0\26\u013f\1\136\1\155\1\u0263"+
-    "\2\155\1\u0263\6\155\1\356\33\155\1\u01d4\15\155\1\356"+
-    "\13\155\1\u0264\23\155\1\u0265\2\155\1\u0265\6\155\1\356"+
-    "\2\155\1\u01d3\2\155\1\u01d3\1\155\24\u01d3\3\155\2\u01d4"+
-    "\3\u0266\1\u0267\5\u01d4\1\u0268\35\u01d4\1\155\2\247\1\250"+
-    "\2\0\1\251\26\247\1\u0269\14\247\2\0\1\u026a\2\0"+
-    "\1\u026a\3\0\1\262\10\0\1\263\1\0\24\263\1\u026b"+
-    "\4\0\1\u01d8\47\0\2\247\1\250\2\0\1\251\33\247"+
-    "\1\u026c\7\247\1\0\2\247\1\250\2\0\1\251\20\247"+
-    "\1\u026d\22\247\1\0\2\247\1\250\2\0\1\251\22\247"+
-    "\1\u0148\20\247\1\0\2\u014c\4\0\22\u014c\1\u014d\1\u014e"+
-    "\1\u014f\1\u026e\5\u014c\1\u0150\7\u014c\1\0\1\u014c\1\u01de"+
-    "\2\0\1\117\1\0\22\u014c\1\u014d\1\u014e\1\u014f\6\u014c"+
-    "\1\u0150\7\u014c\1\0\2\u014c\4\0\22\u014c\1\u014d\1\u014e"+
-    "\1\u014f\6\u014c\1\u0150\1\u014c\1\u026f\5\u014c\1\0\2\u014c"+
-    "\4\0\22\u014c\1\u014d\1\u0270\1\u014f\6\u014c\1\u0150\7\u014c"+
-    "\1\0\1\316\1\u01e1\1\114\1\0\1\17\1\115\5\316"+
-    "\1\u0151\1\316\1\u0271\33\316\1\0\2\u01e2\1\u0152\2\325"+
-    "\1\u01e3\5\u01e2\1\u01e4\35\u01e2\3\325\1\u0152\10\325\1\u0154"+
-    "\36\325\2\u01e2\1\u0152\2\325\1\u01e3\5\u01e2\1\u01e4\1\u01e2"+
-    "\1\u0272\33\u01e2\1\325\2\u0273\1\u0274\2\0\1\u0275\43\u0273"+
-    "\1\0\2\u01e7\1\u01e8\2\121\1\u01e9\7\u01e7\1\u01ea\33\u01e7"+
-    "\2\0\1\u0274\2\0\1\u0274\6\0\1\u0276\40\0\1\u0277"+
-    "\47\0\2\u01ec\1\u0278\45\u01ec\1\0\1\u01ec\1\u015b\1\333"+
-    "\2\u015c\1\u015d\1\u015e\1\333\2\u015b\3\333\1\u015b\1\336"+
-    "\1\u0279\2\333\30\u015b\1\0\2\337\3\u015c\1\u015e\10\337"+
-    "\1\u027a\32\337\1\0\1\u01f2\1\u0163\2\u01f3\1\u01f4\1\u01f5"+
-    "\1\u0163\1\u01f6\1\u01f2\3\u0163\1\u01f2\1\u0166\1\u01f2\2\u0163"+
-    "\1\u01f2\1\u01f8\26\u01f2\3\136\1\u027b\4\136\1\23\12\136"+
-    "\1\137\27\136\1\u01f2\1\u0163\2\u01f3\1\u027c\1\u01f5\1\u0163"+
-    "\1\u01f6\1\u01f2\3\u0163\1\u027d\1\u0166\1\u01f7\2\u0163\1\u01f2"+
-    "\1\u01f8\26\u01f2\1\136\1\u01f2\1\u0163\2\u01f3\1\u01f4\1\u01f5"+
-    "\1\u0163\1\u027e\1\u01f2\3\u0163\1\u01f2\1\u0166\1\u01f2\2\u0163"+
-    "\1\u01f2\1\u01f8\26\u01f2\1\136\2\u0167\2\u01f3\1\u027f\1\u01f5"+
-    "\1\u0167\1\u01f9\4\u0167\1\u0280\1\u0167\1\u01fa\3\u0167\1\u01fb"+
-    "\26\u0167\1\136\2\u0167\3\u01f3\1\u01f5\1\u0167\1\u0281\12\u0167"+
-    "\1\u01fb\26\u0167\1\136\1\146\1\u0163\2\136\1\u0164\1\136"+
-    "\1\u0163\1\36\1\146\3\u0163\1\146\1\u0166\1\u01fc\2\u0163"+
-    "\1\146\1\152\26\146\2\136\1\u0167\2\136\1\u0167\1\136"+
-    "\1\u0167\1\23\1\136\3\u0167\1\136\1\u0167\1\u01fd\2\u0167"+
-    "\1\136\1\137\27\136\1\u0169\1\343\2\u016a\1\u016b\1\u016c"+
-    "\1\343\1\u016d\1\u0169\3\343\1\u0169\1\343\1\u0282\2\343"+
-    "\1\u0169\1\u016f\26\u0169\1\136\2\u0202\3\u020c\1\u020e\5\u0202"+
-    "\1\u0203\35\u0202\1\140\2\u0202\3\u020c\1\u020e\5\u0202\1\u0203"+
-    "\1\u0202\1\u01f9\33\u0202\14\140\1\332\2\140\1\u0283\33\140"+
-    "\1\u0205\1\u0172\2\u0206\1\u0207\1\u0208\1\u0172\2\u0205\2\u0172"+
-    "\1\u0209\1\u0205\1\u0172\1\u0205\2\u0172\30\u0205\3\140\1\u0284"+
-    "\10\140\1\332\36\140\1\u0205\1\u0172\2\u0206\1\u0207\1\u0208"+
-    "\1\u0172\2\u0205\2\u0172\1\u0209\1\u0205\1\u0285\1\u020a\2\u0172"+
-    "\30\u0205\1\140\1\u0205\1\u0172\2\u0206\1\u0286\1\u0208\1\u0172"+
-    "\2\u0205\2\u0172\1\u0209\1\u0287\1\u0172\1\u020a\2\u0172\30\u0205"+
-    "\1\140\1\u020b\1\u0173\2\u020c\1\u020d\1\u020e\1\u0173\2\u020b"+
-    "\2\u0173\1\u0175\1\u020b\1\u0177\1\u020b\2\u0173\30\u020b\3\140"+
-    "\1\u0288\10\140\1\332\36\140\1\u020b\1\u0173\2\u020c\1\u0289"+
-    "\1\u020e\1\u0173\2\u020b\2\u0173\1\u0175\1\u028a\1\u0177\1\u020f"+
-    "\2\u0173\30\u020b\1\140\2\u0202\2\u020c\1\u028b\1\u020e\5\u0202"+
-    "\1\u0203\1\u028c\1\u0202\1\u0210\32\u0202\1\140\1\344\1\u0173"+
-    "\2\140\1\u0174\1\140\1\u0173\2\344\2\u0173\1\u0175\1\344"+
-    "\1\u0177\1\u0212\2\u0173\30\344\1\140\1\351\1\154\2\352"+
-    "\1\u0179\1\354\1\154\2\351\3\154\1\351\1\154\1\u0213"+
-    "\2\154\30\351\1\0\1\361\1\u0214\1\160\1\0\1\157"+
-    "\1\161\5\361\1\u017d\1\361\1\u028d\33\361\2\0\1\u0215"+
-    "\2\0\1\u0215\42\0\1\u028e\4\0\1\u0215\112\0\1\u028f"+
-    "\43\0\1\u0290\40\0\1\u0291\60\0\1\u0292\51\0\1\u0293"+
-    "\16\0\1\374\1\u021d\1\201\1\0\1\u0233\1\207\5\374"+
-    "\1\u0188\1\374\1\u0294\33\374\1\0\2\u021e\4\0\11\u021e"+
-    "\1\u0295\31\u021e\1\0\2\u021f\4\0\11\u021f\1\u0296\31\u021f"+
-    "\2\0\1\231\2\0\1\231\11\0\1\212\2\0\1\212"+
-    "\1\0\3\212\1\u0297\20\212\4\0\1\231\2\0\1\231"+
-    "\11\0\1\212\2\0\1\212\1\0\5\212\1\u0298\16\212"+
-    "\3\0\2\u018d\4\0\5\u018d\1\u0222\1\u018d\1\u0299\33\u018d"+
-    "\1\0\1\136\1\u0223\2\136\1\u0223\2\136\1\23\12\136"+
-    "\1\137\24\136\1\u029a\4\136\1\u0223\4\136\1\23\12\136"+
-    "\1\137\27\136\2\u0190\1\u0223\2\136\1\u0224\1\u0190\1\u029b"+
-    "\12\u0190\1\u0226\26\u0190\10\136\1\23\12\136\1\137\22\136"+
-    "\1\u029c\13\136\1\23\12\136\1\137\12\136\1\u029d\23\136"+
-    "\1\23\12\136\1\137\20\136\1\u029e\15\136\1\23\12\136"+
-    "\1\137\12\136\1\u029f\14\136\2\163\1\164\1\50\1\0"+
-    "\1\165\30\163\1\u02a0\12\163\1\50\13\155\1\356\25\155"+
-    "\1\u022d\10\155\2\u022d\1\u02a1\2\155\1\u02a2\5\u022d\1\u02a3"+
-    "\35\u022d\14\155\1\356\17\155\1\u02a4\31\155\1\356\11\155"+
-    "\1\u02a5\37\155\1\356\17\155\1\u02a6\31\155\1\356\17\155"+
-    "\1\u02a7\16\155\1\0\1\u0233\1\201\1\0\1\u0233\1\207"+
-    "\7\0\1\211\34\0\2\367\1\164\1\50\1\0\1\165"+
-    "\5\367\1\u0182\1\367\1\u02a8\33\367\1\50\2\163\1\164"+
-    "\1\50\1\0\1\165\23\163\1\u02a9\17\163\1\50\2\163"+
-    "\1\164\1\50\1\0\1\165\21\163\1\u02aa\21\163\1\50"+
-    "\1\163\1\u02ab\1\164\1\50\1\u02ac\1\165\10\163\1\u0237"+
-    "\1\u01a5\1\163\1\u0237\1\163\24\u0237\2\163\1\50\27\0"+
-    "\1\u02ad\23\0\1\u02ac\2\0\1\u02ac\11\0\1\u0239\1\u01a7"+
-    "\1\0\1\u0239\1\0\24\u0239\34\0\1\u02ae\20\0\2\u01aa"+
-    "\1\164\1\50\1\0\1\165\2\u01aa\1\u02af\6\u01aa\1\u023d"+
-    "\1\u01aa\1\u02b0\1\u01aa\24\u02b0\2\u01aa\1\50\2\u021e\4\0"+
-    "\2\u021e\1\u02b1\6\u021e\1\u0295\1\u021e\1\u02b2\1\u021e\24\u02b2"+
-    "\2\u021e\1\0\2\u023d\1\164\1\50\1\0\1\165\11\u023d"+
-    "\1\u02b3\31\u023d\1\50\1\u01ae\1\u023e\2\u01ae\1\u023e\5\u01ae"+
-    "\1\u021f\16\u01ae\1\u023f\1\u01ae\1\u0240\6\u01ae\1\u0242\3\u01ae"+
-    "\1\u0243\15\u01ae\1\u021f\24\u01ae\1\u02b4\24\u01ae\1\u021f\16\u01ae"+
-    "\1\u02b5\32\u01ae\1\u021f\26\u01ae\1\u02b6\2\u01ae\1\u02b7\17\u01ae"+
-    "\1\u021f\33\u01ae\1\u02b8\15\u01ae\1\u021f\17\u01ae\1\u02b9\21\u01ae"+
-    "\1\u023e\7\u01ae\1\u021f\37\u01ae\2\u0245\1\205\2\0\1\206"+
-    "\11\u0245\1\u02ba\31\u0245\1\0\1\u01b0\1\u0246\1\u02bb\1\50"+
-    "\1\u02bc\1\u02bd\7\u01b0\1\u02be\1\u01b0\1\u0246\31\u01b0\1\50"+
-    "\1\163\1\230\1\164\1\50\1\231\1\165\10\163\1\173"+
-    "\2\163\1\173\1\163\7\173\1\u0248\14\173\2\163\1\50"+
-    "\1\163\1\u02bf\1\164\1\50\1\u02c0\1\165\3\163\1\u02c1"+
-    "\4\163\1\173\2\163\1\173\1\163\24\173\2\163\1\50"+
-    "\2\u01b3\4\0\5\u01b3\1\u0249\1\u01b3\1\u02c2\33\u01b3\1\0"+
-    "\1\u0123\1\u024a\1\u01b6\1\50\1\217\1\u01b7\5\u0123\1\u01b5"+
-    "\1\u0123\1\u02c3\33\u0123\1\50\1\0\1\u024b\1\u0120\1\0"+
-    "\1\u024b\1\u0121\7\0\1\u0122\13\0\1\363\1\0\1\364"+
-    "\6\0\1\365\3\0\1\366\5\0\1\u02c4\47\0\2\160"+
-    "\3\357\1\360\37\160\1\u02c5\3\160\1\0\2\160\3\357"+
-    "\1\360\27\160\1\u02c6\13\160\1\0\2\160\3\357\1\360"+
-    "\35\160\1\u02c7\5\160\1\0\2\160\3\357\1\360\27\160"+
-    "\1\u02c8\13\160\1\0\1\u012e\1\u0252\1\243\1\50\1\157"+
-    "\1\244\5\u012e\1\u01be\1\u012e\1\u02c9\33\u012e\1\50\33\0"+
-    "\1\u02ca\46\0\1\u02cb\22\0\1\u0256\2\0\1\u0256\3\0"+
-    "\1\u02cc\1\u0257\7\0\1\u02cd\1\0\24\u02cd\3\0\12\u0257"+
-    "\1\u02ce\34\u0257\1\0\2\u0257\1\0\1\u0258\2\0\1\u0258"+
-    "\42\0\1\u026b\4\0\1\u0258\47\0\2\265\1\266\2\0"+
-    "\1\267\33\265\1\u02cf\7\265\1\0\2\265\1\266\2\0"+
-    "\1\267\20\265\1\u02d0\22\265\1\0\2\265\1\266\2\0"+
-    "\1\267\22\265\1\u01c6\20\265\1\0\1\136\1\u02d1\2\136"+
-    "\1\u02d1\2\136\1\23\1\u013d\10\136\1\u013e\1\137\24\u013e"+
-    "\1\u013f\11\136\1\23\12\136\1\137\6\136\1\u02d2\27\136"+
-    "\1\23\12\136\1\137\4\136\1\u02d3\23\136\1\u02d4\2\136"+
-    "\1\u02d4\2\136\1\23\1\136\1\u02d5\4\136\1\u0260\2\136"+
-    "\1\u0260\1\137\24\u0260\3\136\1\155\1\u02d6\2\155\1\u02d6"+
-    "\6\155\1\356\33\155\1\u01d4\15\155\1\356\14\155\1\u02d7"+
-    "\22\155\1\u0265\2\155\1\u0265\3\155\1\u02d8\2\155\1\356"+
-    "\5\155\1\u02d9\1\155\24\u02d9\5\155\1\u02da\10\155\1\356"+
-    "\36\155\2\u01d4\3\u0266\1\u0267\5\u01d4\1\u0268\1\u01d4\1\u02db"+
-    "\33\u01d4\1\155\1\0\1\u02dc\2\0\1\u02dc\42\0\1\u026b"+
-    "\2\0\2\u026b\3\u02dd\1\u02de\43\u026b\1\0\2\247\1\250"+
-    "\2\0\1\251\30\247\1\u02df\12\247\1\0\2\247\1\250"+
-    "\2\0\1\251\24\247\1\u02e0\16\247\1\0\2\u014c\4\0"+
-    "\22\u014c\1\u014d\1\u014e\1\u02e1\6\u014c\1\u0150\7\u014c\1\0"+
-    "\2\u014c\4\0\22\u014c\1\u014d\1\u014e\1\u014f\1\u02e2\5\u014c"+
-    "\1\u0150\7\u014c\1\0\1\u014c\1\u01de\2\0\1\117\1\0"+
-    "\22\u014c\1\u014d\1\u014e\1\u014f\1\u01de\5\u014c\1\u0150\7\u014c"+
-    "\1\0\2\316\4\0\5\316\1\u0151\1\316\1\u02e3\33\316"+
-    "\3\0\1\u0274\47\0\2\u0273\1\u0274\2\0\1\u0275\7\u0273"+
-    "\1\u01e5\33\u0273\1\0\2\u0278\1\u02e4\45\u0278\1\0\1\u0278"+
-    "\1\u015b\1\333\2\u015c\1\u01ee\1\u015e\1\333\2\u015b\3\333"+
-    "\1\u015b\1\336\1\u0279\2\333\30\u015b\1\0\2\337\2\u015c"+
-    "\1\u01f0\1\u015e\10\337\1\u027a\32\337\1\0\1\u01f2\1\u0163"+
-    "\2\u01f3\1\u01f4\1\u01f5\1\u0163\1\u01f6\1\u01f2\3\u0163\1\u01f2"+
-    "\1\u0166\1\u02e5\2\u0163\1\u01f2\1\u01f8\26\u01f2\1\136\2\u0167"+
-    "\3\u01f3\1\u01f5\1\u0167\1\u01f9\6\u0167\1\u02e6\3\u0167\1\u01fb"+
-    "\26\u0167\1\136\1\u0169\1\343\2\u016a\1\u01ff\1\u016c\1\343"+
-    "\1\u016d\1\u0169\3\343\1\u0169\1\343\1\u0282\2\343\1\u0169"+
-    "\1\u016f\26\u0169\1\136\1\140\1\u0202\2\140\1\u0202\1\140"+
-    "\1\u0202\2\140\2\u0202\1\u0203\1\140\1\u0202\1\u0283\2\u0202"+
-    "\31\140\1\u0205\1\u0172\2\u0206\1\u0207\1\u0208\1\u0172\2\u0205"+
-    "\2\u0172\1\u0209\1\u0205\1\u0172\1\u02e7\2\u0172\30\u0205\1\140"+
-    "\1\u020b\1\u0173\2\u020c\1\u020d\1\u020e\1\u0173\2\u020b\2\u0173"+
-    "\1\u0175\1\u020b\1\u0177\1\u02e8\2\u0173\30\u020b\1\140\2\u0202"+
-    "\3\u020c\1\u020e\5\u0202\1\u0203\2\u0202\1\u02e9\32\u0202\1\140"+
-    "\2\361\4\0\5\361\1\u017d\1\361\1\u02ea\33\361\27\0"+
-    "\1\u02eb\53\0\1\u017f\64\0\1\u02ec\34\0\1\u02ed\61\0"+
-    "\1\u02ee\13\0\2\374\4\0\5\374\1\u0188\1\374\1\u02ef"+
-    "\33\374\1\0\2\u0295\4\0\11\u0295\1\u02f0\31\u0295\1\0"+
-    "\1\u021f\1\u0296\1\u02f1\1\0\1\u02bc\1\u02f2\7\u021f\1\u02f3"+
-    "\1\u021f\1\u0296\31\u021f\2\0\1\231\2\0\1\231\11\0"+
-    "\1\212\2\0\1\212\1\0\7\212\1\u0298\14\212\4\0"+
-    "\1\u02c0\2\0\1\u02c0\4\0\1\u02f4\4\0\1\212\2\0"+
-    "\1\212\1\0\24\212\3\0\1\u018d\1\u0299\1\u0102\1\0"+
-    "\1\217\1\u0103\5\u018d\1\u0222\1\u018d\1\u02f5\33\u018d\1\0"+
-    "\7\136\1\23\12\136\1\137\1\136\1\u02f6\34\136\1\23"+
-    "\12\136\1\137\10\136\1\u02f7\25\136\1\23\12\136\1\137"+
-    "\3\136\1\u02f8\32\136\1\23\12\136\1\137\5\136\1\u0190"+
-    "\21\136\2\163\1\164\1\50\1\0\1\165\22\163\1\u02f9"+
-    "\20\163\1\50\1\155\1\u02a1\2\155\1\u02a1\6\155\1\356"+
-    "\33\155\1\u02fa\4\155\1\u02a1\10\155\1\356\36\155\2\u022d"+
-    "\1\u02a1\2\155\1\u02a2\5\u022d\1\u02a3\1\u022d\1\u02fb\33\u022d"+
-    "\14\155\1\356\31\155\1\u02fc\17\155\1\356\21\155\1\u02fd"+
-    "\27\155\1\356\27\155\1\u02fe\21\155\1\356\21\155\1\u02ff"+
-    "\14\155\2\u02a8\1\u0183\1\50\1\0\1\u0184\5\u02a8\1\u0300"+
-    "\35\u02a8\1\50\2\163\1\164\1\50\1\0\1\165\25\163"+
-    "\1\u0301\15\163\1\50\2\163\1\164\1\50\1\0\1\165"+
-    "\22\163\1\u0302\20\163\1\50\1\163\1\u02ab\1\164\1\50"+
-    "\1\u02ac\1\165\2\163\1\u0303\7\163\1\u01a5\1\u0304\1\163"+
-    "\24\u0304\2\163\1\50\1\0\1\u02ac\2\0\1\u02ac\3\0"+
-    "\1\u0305\7\0\1\u01a7\1\u0306\1\0\24\u0306\33\0\1\u0307"+
-    "\54\0\1\u0308\16\0\2\u01aa\1\164\1\50\1\0\1\165"+
-    "\11\u01aa\1\u023d\7\u01aa\1\u0309\21\u01aa\1\50\1\u01aa\1\u030a"+
-    "\1\164\1\50\1\231\1\165\10\u01aa\1\u02b0\1\u023d\1\u01aa"+
-    "\1\u02b0\1\u01aa\24\u02b0\2\u01aa\1\50\2\u021e\4\0\11\u021e"+
-    "\1\u0295\7\u021e\1\u030b\21\u021e\1\0\1\u021e\1\u030c\2\0"+
-    "\1\231\1\0\10\u021e\1\u02b2\1\u0295\1\u021e\1\u02b2\1\u021e"+
-    "\24\u02b2\2\u021e\1\0\2\u02b3\1\164\1\50\1\0\1\165"+
-    "\4\u02b3\1\u030d\36\u02b3\1\50\12\u01ae\1\u021f\26\u01ae\1\u02b5"+
-    "\10\u01ae\2\u02b5\1\u030e\2\u01ae\1\u030f\4\u02b5\1\u0310\36\u02b5"+
-    "\13\u01ae\1\u021f\20\u01ae\1\u0311\30\u01ae\1\u021f\12\u01ae\1\u0312"+
-    "\36\u01ae\1\u021f\20\u01ae\1\u0313\30\u01ae\1\u021f\20\u01ae\1\u0314"+
-    "\16\u01ae\1\u0245\1\u02ba\1\u0315\1\0\1\u02bc\1\u0316\7\u0245"+
-    "\1\u0317\1\u0245\1\u02ba\31\u0245\2\0\1\u0315\2\0\1\u0315"+
-    "\23\0\1\u0318\1\363\1\0\1\364\4\0\1\202\1\0"+
-    "\1\365\3\0\1\366\4\0\1\u02bc\1\u02f1\1\0\1\u02bc"+
-    "\1\u02f2\7\0\1\u0319\36\0\1\u02bb\47\0\2\u01b0\1\164"+
-    "\1\50\1\0\1\165\7\u01b0\1\u031a\1\u01b0\1\u0246\31\u01b0"+
-    "\1\50\1\163\1\u02bf\1\164\1\50\1\u02c0\1\165\2\163"+
-    "\1\u0116\1\u02c1\7\163\1\u0117\1\163\24\u0117\2\163\1\50"+
-    "\1\0\1\u02c0\2\0\1\u02c0\3\0\1\u0118\1\u02f4\7\0"+
-    "\1\u0119\1\0\24\u0119\3\0\1\u01b3\1\u02c2\1\u0120\1\0"+
-    "\1\u0102\1\u0121\5\u01b3\1\u0249\1\u01b3\1\u031b\33\u01b3\1\0"+
-    "\2\u0123\1\164\1\50\1\0\1\165\5\u0123\1\u01b5\1\u0123"+
-    "\1\u031c\33\u0123\1\50\2\160\3\357\1\360\16\160\1\u031d"+
-    "\24\160\1\0\2\160\3\357\1\360\25\160\1\u031e\15\160"+
-    "\1\0\2\160\3\357\1\360\20\160\1\u031f\22\160\1\0"+
-    "\2\160\3\357\1\360\22\160\1\u01b9\20\160\1\0\2\u012e"+
-    "\1\164\1\50\1\0\1\165\5\u012e\1\u01be\1\u012e\1\u0320"+
-    "\33\u012e\1\50\36\0\1\u0321\44\0\1\u0322\47\0\1\u0323"+
-    "\23\0\1\u0324\2\0\1\u0324\4\0\1\u0257\4\0\1\u02cd"+
-    "\2\0\1\u02cd\1\0\24\u02cd\5\0\1\u0325\2\0\1\u0326"+
-    "\44\0\2\265\1\266\2\0\1\267\30\265\1\u0327\12\265"+
-    "\1\0\2\265\1\266\2\0\1\267\24\265\1\u0328\16\265"+
-    "\1\0\1\136\1\u02d1\2\136\1\u02d1\2\136\1\23\12\136"+
-    "\1\137\24\136\1\u013f\11\136\1\23\12\136\1\137\10\136"+
-    "\1\u0329\25\136\1\23\12\136\1\137\5\136\1\u032a\22\136"+
-    "\1\u02d4\2\136\1\u02d4\2\136\1\23\1\u032b\1\u02d5\7\136"+
-    "\1\u032c\1\137\24\u032c\3\136\7\u02d5\1\u032d\2\u02d5\1\u032e"+
-    "\7\u02d5\1\u032f\24\u02d5\1\136\2\u02d5\1\155\1\u0330\2\155"+
-    "\1\u0330\3\155\1\u01d2\2\155\1\356\5\155\1\u01d3\1\155"+
-    "\24\u01d3\1\u01d4\15\155\1\356\15\155\1\u0331\33\155\1\356"+
-    "\13\155\1\u0332\23\155\1\u0333\2\155\1\u0333\4\155\1\u0334"+
-    "\1\155\1\356\2\155\1\u02d9\2\155\1\u02d9\1\155\24\u02d9"+
-    "\3\155\1\0\1\u0335\2\0\1\u0335\42\0\1\u026b\4\0"+
-    "\1\u0336\47\0\1\247\1\u0337\1\250\1\0\1\u0338\1\251"+
-    "\3\247\1\u0339\5\247\1\u033a\31\247\1\0\2\u02e0\1\u033b"+
-    "\2\0\1\u033c\43\u02e0\1\0\2\u014c\4\0\20\u014c\1\u01df"+
-    "\1\u014c\1\u014d\1\u014e\1\u014f\6\u014c\1\u0150\4\u014c\1\u01de"+
-    "\2\u014c\1\0\2\u014c\4\0\22\u014c\1\u014d\1\u014e\1\u014f"+
-    "\6\u014c\1\u0150\4\u014c\1\u033d\2\u014c\1\0\2\u02e3\1\114"+
-    "\2\0\1\115\5\u02e3\1\u033e\35\u02e3\1\0\2\u02e4\1\u033f"+
-    "\45\u02e4\1\0\1\u02e4\1\u01f2\1\u0163\2\u01f3\1\u027c\1\u01f5"+
-    "\1\u0163\1\u01f6\1\u01f2\3\u0163\1\u01f2\1\u0166\1\u02e5\2\u0163"+
-    "\1\u01f2\1\u01f8\26\u01f2\1\136\2\u0167\2\u01f3\1\u027f\1\u01f5"+
-    "\1\u0167\1\u01f9\6\u0167\1\u02e6\3\u0167\1\u01fb\26\u0167\1\136"+
-    "\1\u0205\1\u0172\2\u0206\1\u0286\1\u0208\1\u0172\2\u0205\2\u0172"+
-    "\1\u0209\1\u0205\1\u0172\1\u02e7\2\u0172\30\u0205\1\140\1\u020b"+
-    "\1\u0173\2\u020c\1\u0289\1\u020e\1\u0173\2\u020b\2\u0173\1\u0175"+
-    "\1\u020b\1\u0177\1\u02e8\2\u0173\30\u020b\1\140\2\u0202\2\u020c"+
-    "\1\u028b\1\u020e\5\u0202\1\u0203\2\u0202\1\u02e9\32\u0202\1\140"+
-    "\2\u02ea\1\160\2\0\1\161\5\u02ea\1\u0340\35\u02ea\33\0"+
-    "\1\u017f\47\0\1\u02ed\22\0\1\u0341\2\0\1\u0341\75\0"+
-    "\1\u0342\21\0\2\u02ef\1\201\2\0\1\207\5\u02ef\1\u0343"+
-    "\35\u02ef\1\0\2\u02f0\4\0\4\u02f0\1\u0344\36\u02f0\2\0"+
-    "\1\u02f1\2\0\1\u02f1\23\0\1\u0318\23\0\1\u02f1\47\0"+
-    "\2\u021f\4\0\7\u021f\1\u0345\1\u021f\1\u0296\31\u021f\1\0"+
-    "\2\u018d\4\0\5\u018d\1\u0222\1\u018d\1\u0346\33\u018d\1\0"+
-    "\7\136\1\23\12\136\1\137\20\136\1\u0347\15\136\1\23"+
-    "\12\136\1\137\3\136\1\u0348\32\136\1\23\12\136\1\137"+
-    "\7\136\1\u0190\17\136\1\163\1\230\1\164\1\50\1\231"+
-    "\1\165\43\163\1\50\13\155\1\356\10\155\1\u0349\40\155"+
-    "\1\356\17\155\1\u034a\31\155\1\356\12\155\1\u034b\36\155"+
-    "\1\356\14\155\1\u022d\21\155\2\u02a8\1\u0183\1\50\1\0"+
-    "\1\u0184\5\u02a8\1\u0300\1\u02a8\1\u034c\33\u02a8\1\50\2\163"+
-    "\1\164\1\50\1\0\1\165\30\163\1\u034d\12\163\1\50"+
-    "\2\163\1\164\1\50\1\0\1\165\23\163\1\u034e\17\163"+
-    "\1\50\2\163\1\164\1\50\1\0\1\165\21\163\1\u034f"+
-    "\21\163\1\50\1\163\1\u0350\1\164\1\50\1\u0351\1\165"+
-    "\10\163\1\u0304\1\u01a5\1\163\1\u0304\1\163\24\u0304\2\163"+
-    "\1\50\27\0\1\u0352\23\0\1\u0351\2\0\1\u0351\11\0"+
-    "\1\u0306\1\u01a7\1\0\1\u0306\1\0\24\u0306\34\0\1\u0353"+
-    "\56\0\1\u0354\13\0\2\u01aa\1\164\1\50\1\0\1\165"+
-    "\11\u01aa\1\u023d\10\u01aa\1\u0355\20\u01aa\1\50\1\u01aa\1\u030a"+
-    "\1\164\1\50\1\231\1\165\2\u01aa\1\u0356\6\u01aa\1\u023d"+
-    "\1\u01aa\1\u0357\1\u01aa\24\u0357\2\u01aa\1\50\2\u021e\4\0"+
-    "\11\u021e\1\u0295\10\u021e\1\u0358\20\u021e\1\0\1\u021e\1\u030c"+
-    "\2\0\1\231\1\0\2\u021e\1\u0359\6\u021e\1\u0295\1\u021e"+
-    "\1\u035a\1\u021e\24\u035a\2\u021e\1\0\1\u02b3\1\u030d\1\u035b"+
-    "\1\u035c\1\u035d\1\u035e\4\u02b3\1\u030d\36\u02b3\1\50\1\u01ae"+
-    "\1\u030e\2\u01ae\1\u030e\5\u01ae\1\u021f\34\u01ae\1\u035f\4\u01ae"+
-    "\1\u030e\7\u01ae\1\u021f\37\u01ae\2\u0310\1\u0215\2\0\1\u0216"+
-    "\11\u0310\1\u0360\31\u0310\1\0\12\u01ae\1\u021f\32\u01ae\1\u0361"+
-    "\16\u01ae\1\u021f\22\u01ae\1\u0362\26\u01ae\1\u021f\30\u01ae\1\u0363"+
-    "\20\u01ae\1\u021f\22\u01ae\1\u0364\14\u01ae\1\0\1\u0315\2\0"+
-    "\1\u0315\23\0\1\u0318\1\363\1\0\1\364\6\0\1\365"+
-    "\3\0\1\366\5\0\1\u0315\47\0\2\u0245\1\205\2\0"+
-    "\1\206\7\u0245\1\u0365\1\u0245\1\u02ba\31\u0245\36\0\1\u0366"+
-    "\31\0\1\u0367\34\0\2\u031a\1\u02bb\1\50\1\0\1\u02bd"+
-    "\11\u031a\1\u0368\31\u031a\1\50\2\u01b3\4\0\5\u01b3\1\u0249"+
-    "\1\u01b3\1\u0369\33\u01b3\1\0\2\u031c\1\u01b6\1\50\1\0"+
-    "\1\u01b7\5\u031c\1\u036a\35\u031c\1\50\2\160\3\357\1\360"+
-    "\35\160\1\u036b\5\160\1\0\2\160\3\357\1\360\20\160"+
-    "\1\u036c\22\160\1\0\2\160\3\357\1\360\24\160\1\u01b9"+
-    "\16\160\1\0\2\u0320\1\243\1\50\1\0\1\244\5\u0320"+
-    "\1\u036d\35\u0320\1\50\30\0\1\u036e\54\0\1\u036f\46\0"+
-    "\1\u0370\22\0\1\u0324\2\0\1\u0324\3\0\1\u0371\1\u0257"+
-    "\7\0\1\u0372\1\0\24\u0372\4\0\1\u0325\2\0\1\u0325"+
-    "\42\0\1\u0373\4\0\1\u0325\47\0\1\265\1\u0374\1\266"+
-    "\1\0\1\u0338\1\267\3\265\1\u0375\5\265\1\u0376\31\265"+
-    "\1\0\2\u0328\1\u0377\2\0\1\u0378\43\u0328\1\0\7\136"+
-    "\1\23\12\136\1\137\13\136\1\u0379\22\136\1\23\12\136"+
-    "\1\137\6\136\1\u037a\27\136\1\23\12\136\1\137\4\136"+
-    "\1\u037b\23\136\1\u037c\2\136\1\u037c\2\136\1\23\1\136"+
-    "\1\u02d5\4\136\1\u032c\2\136\1\u032c\1\137\24\u032c\5\136"+
-    "\1\u037d\2\136\1\u037e\1\136\1\23\12\136\1\137\27\136"+
-    "\7\u02d5\1\u037f\2\u02d5\1\u032e\7\u02d5\1\u032f\24\u02d5\1\136"+
-    "\2\u02d5\1\155\1\u0330\2\155\1\u0330\6\155\1\356\33\155"+
-    "\1\u01d4\15\155\1\356\17\155\1\u0380\31\155\1\356\14\155"+
-    "\1\u0381\22\155\1\u0333\2\155\1\u0333\3\155\1\u0382\1\u0334"+
-    "\1\155\1\356\5\155\1\u0383\1\155\24\u0383\3\155\12\u0334"+
-    "\1\u0384\1\u0385\33\u0334\1\155\2\u0334\1\0\1\u0258\2\0"+
-    "\1\u0258\3\0\1\262\10\0\1\263\1\0\24\263\1\u026b"+
-    "\2\0\1\u0386\1\u0337\1\250\1\0\1\u0387\1\251\11\u0386"+
-    "\1\u0388\31\u0386\1\0\1\u0389\1\u0338\2\0\1\u0387\1\0"+
-    "\11\u0389\1\u038a\31\u0389\1\0\2\u0339\1\250\2\0\1\251"+
-    "\11\u0339\1\u038b\31\u0339\1\0\1\247\1\u033a\1\u038c\1\0"+
-    "\1\u038d\1\u038e\7\247\1\u038f\33\247\2\0\1\u0390\2\0"+
-    "\1\u0390\3\0\1\262\10\0\1\263\1\0\24\263\1\u0391"+
-    "\4\0\1\u033b\47\0\2\u014c\4\0\22\u014c\1\u014d\1\u014e"+
-    "\1\u014f\6\u014c\1\u0150\1\u01de\6\u014c\1\0\2\u02e3\1\114"+
-    "\2\0\1\115\5\u02e3\1\u033e\1\u02e3\1\u0392\33\u02e3\1\0"+
-    "\2\u033f\1\u0393\45\u033f\1\0\1\u033f\2\u02ea\1\160\2\0"+
-    "\1\161\5\u02ea\1\u0340\1\u02ea\1\u0394\33\u02ea\2\0\1\u0341"+
-    "\2\0\1\u0341\17\0\1\u0395\1\0\1\u0396\2\0\1\u0397"+
-    "\1\0\1\u0398\6\0\1\u0399\10\0\1\231\2\0\1\231"+
-    "\45\0\2\u02ef\1\201\2\0\1\207\5\u02ef\1\u0343\1\u02ef"+
-    "\1\u039a\33\u02ef\1\0\1\u02f0\1\u0344\2\u039b\1\u035d\1\u039c"+
-    "\4\u02f0\1\u0344\36\u02f0\1\0\2\u0345\1\u02f1\2\0\1\u02f2"+
-    "\11\u0345\1\u039d\31\u0345\1\0\2\u0346\1\u0102\2\0\1\u0103"+
-    "\5\u0346\1\u039e\35\u0346\1\0\7\136\1\23\12\136\1\137"+
-    "\5\136\1\u0348\22\136\1\u039f\2\136\1\u039f\2\136\1\23"+
-    "\12\136\1\137\27\136\13\155\1\356\27\155\1\u03a0\21\155"+
-    "\1\356\12\155\1\u03a1\36\155\1\356\16\155\1\u022d\17\155"+
-    "\1\u02a8\1\u034c\1\u0183\1\50\1\u0233\1\u0184\5\u02a8\1\u0300"+
-    "\35\u02a8\1\50\2\163\1\164\1\50\1\0\1\165\22\163"+
-    "\1\u03a2\20\163\1\50\2\163\1\164\1\50\1\0\1\165"+
-    "\25\163\1\u03a3\15\163\1\50\2\163\1\164\1\50\1\0"+
-    "\1\165\22\163\1\u03a4\20\163\1\50\1\163\1\u0350\1\164"+
-    "\1\50\1\u0351\1\165\2\163\1\u03a5\7\163\1\u01a5\1\u03a6"+
-    "\1\163\24\u03a6\2\163\1\50\1\0\1\u0351\2\0\1\u0351"+
-    "\3\0\1\u03a7\7\0\1\u01a7\1\u03a8\1\0\24\u03a8\33\0"+
-    "\1\u03a9\54\0\1\u03aa\46\0\1\u03ab\21\0\2\u01aa\1\164"+
-    "\1\50\1\0\1\165\11\u01aa\1\u023d\11\u01aa\1\u03ac\17\u01aa"+
-    "\1\50\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d"+
-    "\7\u01aa\1\u03ad\21\u01aa\1\50\1\u01aa\1\u03ae\1\164\1\50"+
-    "\1\u01a4\1\165\10\u01aa\1\u0357\1\u03af\1\u01aa\1\u0357\1\u01aa"+
-    "\24\u0357\2\u01aa\1\50\2\u021e\4\0\11\u021e\1\u0295\11\u021e"+
-    "\1\u03b0\17\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\7\u021e"+
-    "\1\u03b1\21\u021e\1\0\1\u021e\1\u03b2\2\0\1\u01a4\1\0"+
-    "\10\u021e\1\u035a\1\u03b3\1\u021e\1\u035a\1\u021e\24\u035a\2\u021e"+
-    "\2\0\1\u03b4\2\u039b\1\u035d\1\u039c\46\0\1\u03b5\47\0"+
-    "\1\u0310\1\u0360\1\u03b6\1\0\1\u02bc\1\u03b7\7\u0310\1\u03b8"+
-    "\1\u0310\1\u0360\31\u0310\1\0\12\u01ae\1\u021f\11\u01ae\1\u03b9"+
-    "\37\u01ae\1\u021f\20\u01ae\1\u03ba\30\u01ae\1\u021f\13\u01ae\1\u03bb"+
-    "\35\u01ae\1\u021f\15\u01ae\1\u02b5\21\u01ae\2\u0365\1\u0315\2\0"+
-    "\1\u0316\11\u0365\1\u03bc\31\u0365\43\0\1\u03bd\7\0\2\u0367"+
-    "\1\u02f1\2\0\1\u02f2\43\u0367\1\0\1\u031a\1\u0368\1\u02bb"+
-    "\1\50\1\u02bc\1\u02bd\11\u031a\1\u0368\31\u031a\1\50\2\u0369"+
-    "\1\u0120\2\0\1\u0121\5\u0369\1\u03be\35\u0369\1\0\2\u031c"+
-    "\1\u01b6\1\50\1\0\1\u01b7\5\u031c\1\u036a\1\u031c\1\u03bf"+
-    "\33\u031c\1\50\2\160\3\357\1\360\22\160\1\u036c\20\160"+
-    "\1\0\1\160\1\u03c0\2\357\1\u03c1\1\360\43\160\1\0"+
-    "\2\u0320\1\243\1\50\1\0\1\244\5\u0320\1\u036d\1\u0320"+
-    "\1\u03c2\33\u0320\1\50\1\0\1\u0133\2\0\1\u0133\103\0"+
-    "\1\u03c3\44\0\1\u03c4\47\0\1\u03c5\23\0\1\u03c6\2\0"+
-    "\1\u03c6\4\0\1\u0257\4\0\1\u0372\2\0\1\u0372\1\0"+
-    "\24\u0372\3\0\2\u0373\3\u03c7\1\u03c8\43\u0373\1\0\1\u03c9"+
-    "\1\u0374\1\266\1\0\1\u0387\1\267\11\u03c9\1\u03ca\31\u03c9"+
-    "\1\0\2\u0375\1\266\2\0\1\267\11\u0375\1\u03cb\31\u0375"+
-    "\1\0\1\265\1\u0376\1\u03cc\1\0\1\u038d\1\u03cd\7\265"+
-    "\1\u03ce\33\265\2\0\1\u0377\2\0\1\u0377\42\0\1\u0391"+
-    "\4\0\1\u0377\47\0\7\136\1\23\12\136\1\137\5\136"+
-    "\1\u03cf\30\136\1\23\12\136\1\137\10\136\1\u03d0\25\136"+
-    "\1\23\12\136\1\137\5\136\1\u03d1\22\136\1\u037c\2\136"+
-    "\1\u037c\2\136\1\23\1\u03d2\1\u02d5\7\136\1\u03d3\1\137"+
-    "\24\u03d3\4\136\1\u037d\2\136\1\u037d\2\136\1\23\12\136"+
-    "\1\137\24\136\1\u03d4\4\136\1\u037d\4\136\1\23\12\136"+
-    "\1\137\27\136\13\155\1\356\22\155\1\u03d5\26\155\1\356"+
-    "\15\155\1\u03d6\33\155\1\356\13\155\1\u03d7\23\155\1\u03d8"+
-    "\2\155\1\u03d8\4\155\1\u0334\1\155\1\356\2\155\1\u0383"+
-    "\2\155\1\u0383\1\155\24\u0383\5\155\1\u03d9\2\155\1\u03da"+
-    "\5\155\1\356\36\155\12\u0334\1\u0384\1\u0385\1\u0334\1\u03db"+
-    "\31\u0334\1\155\2\u0334\2\u0386\1\250\2\0\1\251\11\u0386"+
-    "\1\u0388\31\u0386\1\0\1\u03dc\1\u0387\2\0\1\u0387\1\0"+
-    "\11\u03dc\1\u03dd\31\u03dc\1\0\1\u0386\1\u0388\1\u03de\1\0"+
-    "\1\u03df\1\u03e0\7\u0386\1\u03e1\1\u0386\1\u0388\31\u0386\1\0"+
-    "\2\u0389\4\0\11\u0389\1\u038a\31\u0389\1\0\1\u0389\1\u038a"+
-    "\1\u03e2\1\0\1\u03df\1\u03e3\7\u0389\1\u03e4\1\u0389\1\u038a"+
-    "\31\u0389\1\0\1\u0339\1\u038b\1\u038c\1\0\1\u038d\1\u038e"+
-    "\7\u0339\1\u03e5\1\u0339\1\u038b\31\u0339\2\0\1\u03e6\1\u03e7"+
-    "\1\0\1\u03e6\1\u03e8\2\0\1\262\4\0\1\u03e9\3\0"+
-    "\1\263\1\0\24\263\1\264\1\u03ea\2\0\1\u038d\1\u03e7"+
-    "\1\0\1\u038d\1\u03e8\7\0\1\u03e9\36\0\1\u038c\47\0"+
-    "\2\247\1\250\2\0\1\251\5\247\1\u03eb\1\247\1\u03ec"+
-    "\33\247\2\0\1\u03ed\2\0\1\u03ed\42\0\1\u0391\2\0"+
-    "\2\u0391\3\u03ee\1\u03ef\43\u0391\1\0\1\u02e3\1\u0392\1\114"+
-    "\1\0\1\17\1\115\5\u02e3\1\u033e\35\u02e3\1\0\2\u0393"+
-    "\1\u03f0\45\u0393\1\0\1\u0393\1\u02ea\1\u0394\1\160\1\0"+
-    "\1\157\1\161\5\u02ea\1\u0340\35\u02ea\26\0\1\u03f1\61\0"+
-    "\1\u03f2\47\0\1\u03f3\54\0\1\u03f4\56\0\1\u03f5\6\0"+
-    "\1\u02ef\1\u039a\1\201\1\0\1\u0233\1\207\5\u02ef\1\u0343"+
-    "\35\u02ef\3\0\1\u03f6\47\0\1\u0345\1\u039d\1\u02f1\1\0"+
-    "\1\u02bc\1\u02f2\11\u0345\1\u039d\31\u0345\1\0\2\u0346\1\u0102"+
-    "\2\0\1\u0103\5\u0346\1\u039e\1\u0346\1\u03f7\33\u0346\1\0"+
-    "\1\136\1\u039f\2\136\1\u039f\2\136\1\23\12\136\1\137"+
-    "\1\136\1\u03f8\1\136\1\u03f9\2\136\1\u03fa\1\136\1\u03fb"+
-    "\6\136\1\u03fc\7\136\13\155\1\356\14\155\1\u03a1\22\155"+
-    "\1\u03fd\2\155\1\u03fd\6\155\1\356\36\155\1\163\1\u01a3"+
-    "\1\164\1\50\1\u01a4\1\165\11\163\1\u01a5\31\163\1\50"+
-    "\2\163\1\164\1\50\1\0\1\165\30\163\1\u03fe\12\163"+
-    "\1\50\2\163\1\164\1\50\1\0\1\165\23\163\1\u03ff"+
-    "\17\163\1\50\2\163\1\164\1\50\1\0\1\165\21\163"+
-    "\1\u0400\21\163\1\50\1\163\1\u0401\1\164\1\50\1\u0402"+
-    "\1\165\10\163\1\u03a6\1\u01a5\1\163\1\u03a6\1\163\24\u03a6"+
-    "\2\163\1\50\27\0\1\u0403\23\0\1\u0402\2\0\1\u0402"+
-    "\11\0\1\u03a8\1\u01a7\1\0\1\u03a8\1\0\24\u03a8\34\0"+
-    "\1\u0404\56\0\1\u0405\14\0\1\u01a4\2\0\1\u01a4\12\0"+
-    "\1\u01a7\32\0\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa"+
-    "\1\u023d\13\u01aa\1\u0406\15\u01aa\1\50\2\u01aa\1\164\1\50"+
-    "\1\0\1\165\11\u01aa\1\u023d\10\u01aa\1\u0407\20\u01aa\1\50"+
-    "\1\u01aa\1\u03ae\1\164\1\50\1\u01a4\1\165\2\u01aa\1\u0408"+
-    "\6\u01aa\1\u023d\1\u0409\1\u040a\1\u01aa\24\u040a\2\u01aa\1\50"+
-    "\2\u021e\4\0\11\u021e\1\u0295\13\u021e\1\u040b\15\u021e\1\0"+
-    "\2\u021e\4\0\11\u021e\1\u0295\10\u021e\1\u040c\20\u021e\1\0"+
-    "\1\u021e\1\u03b2\2\0\1\u01a4\1\0\2\u021e\1\u040d\6\u021e"+
-    "\1\u0295\1\u040e\1\u040f\1\u021e\24\u040f\2\u021e\2\0\1\u03b6"+
-    "\2\0\1\u03b6\23\0\1\u0318\16\0\1\u028e\4\0\1\u03b6"+
-    "\47\0\2\u0310\1\u0215\2\0\1\u0216\7\u0310\1\u0410\1\u0310"+
-    "\1\u0360\31\u0310\1\0\12\u01ae\1\u021f\30\u01ae\1\u0411\20\u01ae"+
-    "\1\u021f\13\u01ae\1\u0412\35\u01ae\1\u021f\17\u01ae\1\u02b5\17\u01ae"+
-    "\1\u0365\1\u03bc\1\u0315\1\0\1\u02bc\1\u0316\11\u0365\1\u03bc"+
-    "\31\u0365\31\0\1\u0413\21\0\2\u0369\1\u0120\2\0\1\u0121"+
-    "\5\u0369\1\u03be\1\u0369\1\u0414\33\u0369\1\0\1\u031c\1\u03bf"+
-    "\1\u01b6\1\50\1\217\1\u01b7\5\u031c\1\u036a\35\u031c\1\50"+
-    "\1\160\1\u03c0\2\357\1\u03c1\1\360\16\160\1\u0415\1\160"+
-    "\1\u0416\2\160\1\u0417\1\160\1\u0418\6\160\1\u0419\6\160"+
-    "\1\0\1\u0320\1\u03c2\1\243\1\50\1\157\1\244\5\u0320"+
-    "\1\u036d\35\u0320\1\50\30\0\1\u041a\54\0\1\u041b\46\0"+
-    "\1\u041c\22\0\1\u03c6\2\0\1\u03c6\4\0\1\u0257\42\0"+
-    "\1\u041d\47\0\2\u03c9\1\266\2\0\1\267\11\u03c9\1\u03ca"+
-    "\31\u03c9\1\0\1\u03c9\1\u03ca\1\u041e\1\0\1\u03df\1\u041f"+
-    "\7\u03c9\1\u0420\1\u03c9\1\u03ca\31\u03c9\1\0\1\u0375\1\u03cb"+
-    "\1\u03cc\1\0\1\u038d\1\u03cd\7\u0375\1\u0421\1\u0375\1\u03cb"+
-    "\31\u0375\2\0\1\u03cc\1\u03e7\1\0\1\u03cc\1\u03e8\7\0"+
-    "\1\u03e9\31\0\1\264\1\u03ea\3\0\1\u03cc\47\0\2\265"+
-    "\1\266\2\0\1\267\5\265\1\u0422\1\265\1\u0423\33\265"+
-    "\1\0\1\136\1\u01cc\2\136\1\u01cc\2\136\1\23\12\136"+
-    "\1\137\36\136\1\23\12\136\1\137\13\136\1\u0424\22\136"+
-    "\1\23\12\136\1\137\6\136\1\u0425\27\136\1\23\12\136"+
-    "\1\137\4\136\1\u0426\23\136\1\u0427\2\136\1\u0427\2\136"+
-    "\1\23\1\136\1\u02d5\4\136\1\u03d3\2\136\1\u03d3\1\137"+
-    "\24\u03d3\3\136\2\u03d4\3\u0428\1\u0429\1\u03d4\1\u042a\12\u03d4"+
-    "\1\u042b\26\u03d4\1\136\13\155\1\356\14\155\1\u042c\34\155"+
-    "\1\356\17\155\1\u042d\31\155\1\356\14\155\1\u042e\22\155"+
-    "\1\u03d8\2\155\1\u03d8\3\155\1\u042f\1\u0334\1\155\1\356"+
-    "\5\155\1\u0430\1\155\24\u0430\4\155\1\u03d9\2\155\1\u03d9"+
-    "\6\155\1\356\33\155\1\u0431\4\155\1\u03d9\10\155\1\356"+
-    "\36\155\2\u03dc\4\0\11\u03dc\1\u0432\31\u03dc\1\0\1\u03dc"+
-    "\1\u03dd\1\u03e2\1\0\1\u03df\1\u03e3\7\u03dc\1\u0433\1\u03dc"+
-    "\1\u0432\31\u03dc\2\0\1\u03df\1\u03e2\1\0\1\u03df\1\u03e3"+
-    "\7\0\1\u0434\36\0\1\u03de\47\0\2\u0386\1\250\2\0"+
-    "\1\251\5\u0386\1\u0435\1\u0386\1\u0436\1\u0386\1\u0388\31\u0386"+
-    "\2\0\2\u03e7\1\0\1\u03e7\1\u03e8\7\0\1\u03e9\32\0"+
-    "\1\u03ea\3\0\1\u03e2\47\0\2\u0389\4\0\5\u0389\1\u0437"+
-    "\1\u0389\1\u0438\1\u0389\1\u038a\31\u0389\1\0\2\u0339\1\250"+
-    "\2\0\1\251\5\u0339\1\u0439\1\u0339\1\u043a\1\u0339\1\u038b"+
-    "\31\u0339\2\0\1\u043b\1\u03e7\1\0\1\u043b\1\u03e8\7\0"+
-    "\1\u03e9\31\0\1\264\1\u03ea\3\0\1\u03e7\62\0\1\u043c"+
-    "\1\0\1\u043d\34\0\2\u03eb\1\250\2\0\1\251\5\u03eb"+
-    "\1\u043e\35\u03eb\1\0\2\u03ec\1\u038c\2\0\1\u038e\43\u03ec"+
-    "\2\0\1\u043f\2\0\1\u043f\42\0\1\u0391\4\0\1\u0440"+
-    "\47\0\2\u03f0\1\u0441\45\u03f0\1\0\1\u03f0\42\0\1\u0442"+
-    "\33\0\1\u0443\63\0\1\u0444\56\0\1\u0445\32\0\1\u0446"+
-    "\25\0\1\u0346\1\u03f7\1\u0102\1\0\1\217\1\u0103\5\u0346"+
-    "\1\u039e\35\u0346\1\0\7\136\1\23\12\136\1\137\2\136"+
-    "\1\u0447\33\136\1\23\12\136\1\137\12\136\1\u0448\23\136"+
-    "\1\23\12\136\1\137\10\136\1\u0449\25\136\1\23\12\136"+
-    "\1\137\13\136\1\u044a\22\136\1\23\12\136\1\137\20\136"+
-    "\1\u044b\6\136\1\155\1\u03fd\2\155\1\u03fd\6\155\1\356"+
-    "\10\155\1\u044c\1\155\1\u044d\2\155\1\u044e\1\155\1\u044f"+
-    "\6\155\1\u0450\7\155\2\163\1\164\1\50\1\0\1\165"+
-    "\22\163\1\u0451\20\163\1\50\2\163\1\164\1\50\1\0"+
-    "\1\165\25\163\1\u0452\15\163\1\50\2\163\1\164\1\50"+
-    "\1\0\1\165\22\163\1\u0453\20\163\1\50\1\163\1\u0401"+
-    "\1\164\1\50\1\u0402\1\165\12\163\1\u01a5\30\163\1\50"+
-    "\1\0\1\u0402\2\0\1\u0402\13\0\1\u01a7\61\0\1\u0454"+
-    "\54\0\1\u0455\46\0\1\u0456\21\0\2\u01aa\1\164\1\50"+
-    "\1\0\1\165\11\u01aa\1\u023d\16\u01aa\1\u0457\12\u01aa\1\50"+
-    "\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\11\u01aa"+
-    "\1\u0458\17\u01aa\1\50\2\u01aa\1\164\1\50\1\0\1\165"+
-    "\11\u01aa\1\u023d\7\u01aa\1\u0459\21\u01aa\1\50\1\u01aa\1\u045a"+
-    "\1\164\1\50\1\u02ac\1\165\10\u01aa\1\u040a\1\u03af\1\u01aa"+
-    "\1\u040a\1\u01aa\24\u040a\2\u01aa\1\50\2\u021e\4\0\11\u021e"+
-    "\1\u0295\16\u021e\1\u045b\12\u021e\1\0\2\u021e\4\0\11\u021e"+
-    "\1\u0295\11\u021e\1\u045c\17\u021e\1\0\2\u021e\4\0\11\u021e"+
-    "\1\u0295\7\u021e\1\u045d\21\u021e\1\0\1\u021e\1\u045e\2\0"+
-    "\1\u02ac\1\0\10\u021e\1\u040f\1\u03b3\1\u021e\1\u040f\1\u021e"+
-    "\24\u040f\2\u021e\1\0\2\u0410\1\u03b6\2\0\1\u03b7\11\u0410"+
-    "\1\u045f\31\u0410\1\0\12\u01ae\1\u021f\15\u01ae\1\u0412\22\u01ae"+
-    "\1\u0460\2\u01ae\1\u0460\5\u01ae\1\u021f\37\u01ae\1\u0369\1\u0414"+
-    "\1\u0120\1\0\1\u0102\1\u0121\5\u0369\1\u03be\35\u0369\1\0"+
-    "\2\160\3\357\1\360\17\160\1\u0461\23\160\1\0\2\160"+
-    "\3\357\1\360\27\160\1\u0462\13\160\1\0\2\160\3\357"+
-    "\1\360\25\160\1\u0463\15\160\1\0\2\160\3\357\1\360"+
-    "\30\160\1\u0464\12\160\1\0\2\160\3\357\1\360\35\160"+
-    "\1\u0465\5\160\2\0\1\u0256\2\0\1\u0256\4\0\1\u0257"+
-    "\76\0\1\u0466\44\0\1\u0467\22\0\1\u041e\47\0\2\u03c9"+
-    "\1\266\2\0\1\267\5\u03c9\1\u0468\1\u03c9\1\u0469\1\u03c9"+
-    "\1\u03ca\31\u03c9\1\0\2\u0375\1\266\2\0\1\267\5\u0375"+
-    "\1\u046a\1\u0375\1\u046b\1\u0375\1\u03cb\31\u0375\1\0\2\u0422"+
-    "\1\266\2\0\1\267\5\u0422\1\u046c\35\u0422\1\0\2\u0423"+
-    "\1\u03cc\2\0\1\u03cd\43\u0423\1\0\7\136\1\23\12\136"+
-    "\1\137\5\136\1\u046d\30\136\1\23\12\136\1\137\10\136"+
-    "\1\u046e\25\136\1\23\12\136\1\137\5\136\1\u046f\22\136"+
-    "\1\u0427\2\136\1\u0427\2\136\1\23\1\136\1\u02d5\10\136"+
-    "\1\137\31\136\1\u0470\4\136\1\23\12\136\1\137\27\136"+
-    "\2\u03d4\3\u0428\1\u0429\1\u03d4\1\u0471\12\u03d4\1\u042b\26\u03d4"+
-    "\1\136\1\155\1\u0265\2\155\1\u0265\6\155\1\356\51\155"+
-    "\1\356\22\155\1\u0472\26\155\1\356\15\155\1\u0473\33\155"+
-    "\1\356\13\155\1\u0474\23\155\1\u0475\2\155\1\u0475\4\155"+
-    "\1\u0334\1\155\1\356\2\155\1\u0430\2\155\1\u0430\1\155"+
-    "\24\u0430\3\155\2\u0431\3\u0476\1\u0477\5\u0431\1\u0478\35\u0431"+
-    "\1\155\1\u03dc\1\u0432\1\u0479\1\0\1\u047a\1\u047b\7\u03dc"+
-    "\1\u047c\1\u03dc\1\u0432\31\u03dc\1\0\2\u03dc\4\0\5\u03dc"+
-    "\1\u047d\1\u03dc\1\u047e\1\u03dc\1\u0432\31\u03dc\14\0\1\u047f"+
-    "\1\0\1\u0480\34\0\2\u0435\1\250\2\0\1\251\5\u0435"+
-    "\1\u0481\3\u0435\1\u0482\31\u0435\1\0\2\u0436\1\u03de\2\0"+
-    "\1\u03e0\11\u0436\1\u0483\31\u0436\1\0\2\u0437\4\0\5\u0437"+
-    "\1\u0484\3\u0437\1\u0485\31\u0437\1\0\2\u0438\1\u03e2\2\0"+
-    "\1\u03e3\11\u0438\1\u0486\31\u0438\1\0\2\u0439\1\250\2\0"+
-    "\1\251\5\u0439\1\u0487\3\u0439\1\u0488\31\u0439\1\0\2\u043a"+
-    "\1\u038c\2\0\1\u038e\11\u043a\1\u0489\31\u043a\2\0\1\u048a"+
-    "\1\u03e7\1\0\1\u048a\1\u03e8\7\0\1\u03e9\31\0\1\264"+
-    "\1\u03ea\1\0\2\u043c\4\0\5\u043c\1\u048b\35\u043c\1\0"+
-    "\2\u043d\1\u03e7\2\0\1\u03e8\43\u043d\1\0\2\u03eb\1\250"+
-    "\2\0\1\251\5\u03eb\1\u043e\1\u03eb\1\u048c\33\u03eb\2\0"+
-    "\1\u0377\2\0\1\u0377\3\0\1\262\10\0\1\263\1\0"+
-    "\24\263\1\u0391\2\0\2\u0441\1\u048d\45\u0441\1\0\1\u0441"+
-    "\43\0\1\u048e\50\0\1\u048f\33\0\1\u0490\55\0\1\u0491"+
-    "\64\0\1\u0492\6\0\7\136\1\23\12\136\1\137\17\136"+
-    "\1\u0493\16\136\1\23\12\136\1\137\1\136\1\u0494\34\136"+
-    "\1\23\12\136\1\137\13\136\1\u0495\22\136\1\23\12\136"+
-    "\1\137\20\136\1\u0496\15\136\1\23\12\136\1\137\1\136"+
-    "\1\u0497\25\136\13\155\1\356\11\155\1\u0498\37\155\1\356"+
-    "\21\155\1\u0499\27\155\1\356\17\155\1\u049a\31\155\1\356"+
-    "\22\155\1\u049b\26\155\1\356\27\155\1\u049c\6\155\1\163"+
-    "\1\u02ab\1\164\1\50\1\u02ac\1\165\11\163\1\u01a5\31\163"+
-    "\1\50\2\163\1\164\1\50\1\0\1\165\30\163\1\u049d"+
-    "\12\163\1\50\2\163\1\164\1\50\1\0\1\165\23\163"+
-    "\1\u049e\17\163\1\50\31\0\1\u049f\56\0\1\u04a0\14\0"+
-    "\1\u02ac\2\0\1\u02ac\12\0\1\u01a7\32\0\2\u01aa\1\164"+
-    "\1\50\1\0\1\165\11\u01aa\1\u023d\10\u01aa\1\u04a1\20\u01aa"+
-    "\1\50\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d"+
-    "\13\u01aa\1\u04a2\15\u01aa\1\50\2\u01aa\1\164\1\50\1\0"+
-    "\1\165\11\u01aa\1\u023d\10\u01aa\1\u04a3\20\u01aa\1\50\1\u01aa"+
-    "\1\u045a\1\164\1\50\1\u02ac\1\165\2\u01aa\1\u04a4\6\u01aa"+
-    "\1\u023d\1\u0409\1\u04a5\1\u01aa\24\u04a5\2\u01aa\1\50\2\u021e"+
-    "\4\0\11\u021e\1\u0295\10\u021e\1\u04a6\20\u021e\1\0\2\u021e"+
-    "\4\0\11\u021e\1\u0295\13\u021e\1\u04a7\15\u021e\1\0\2\u021e"+
-    "\4\0\11\u021e\1\u0295\10\u021e\1\u04a8\20\u021e\1\0\1\u021e"+
-    "\1\u045e\2\0\1\u02ac\1\0\2\u021e\1\u04a9\6\u021e\1\u0295"+
-    "\1\u040e\1\u04aa\1\u021e\24\u04aa\2\u021e\1\0\1\u0410\1\u045f"+
-    "\1\u03b6\1\0\1\u02bc\1\u03b7\11\u0410\1\u045f\31\u0410\1\0"+
-    "\1\u01ae\1\u0460\2\u01ae\1\u0460\5\u01ae\1\u021f\11\u01ae\1\u04ab"+
-    "\1\u01ae\1\u04ac\2\u01ae\1\u04ad\1\u01ae\1\u04ae\6\u01ae\1\u04af"+
-    "\7\u01ae\2\160\3\357\1\360\34\160\1\u04b0\6\160\1\0"+
-    "\2\160\3\357\1\360\16\160\1\u04b1\24\160\1\0\2\160"+
-    "\3\357\1\360\30\160\1\u04b2\12\160\1\0\2\160\3\357"+
-    "\1\360\35\160\1\u04b3\5\160\1\0\2\160\3\357\1\360"+
-    "\16\160\1\u04b4\24\160\31\0\1\u04b5\54\0\1\u04b6\16\0"+
-    "\2\u0468\1\266\2\0\1\267\5\u0468\1\u04b7\3\u0468\1\u04b8"+
-    "\31\u0468\1\0\2\u0469\1\u041e\2\0\1\u041f\11\u0469\1\u04b9"+
-    "\31\u0469\1\0\2\u046a\1\266\2\0\1\267\5\u046a\1\u04ba"+
-    "\3\u046a\1\u04bb\31\u046a\1\0\2\u046b\1\u03cc\2\0\1\u03cd"+
-    "\11\u046b\1\u04bc\31\u046b\1\0\2\u0422\1\266\2\0\1\267"+
-    "\5\u0422\1\u046c\1\u0422\1\u04bd\33\u0422\1\0\1\136\1\u02d4"+
-    "\2\136\1\u02d4\2\136\1\23\1\136\1\u02d5\10\136\1\137"+
-    "\36\136\1\23\12\136\1\137\13\136\1\u04be\22\136\1\23"+
-    "\12\136\1\137\6\136\1\u04bf\20\136\13\155\1\356\14\155"+
-    "\1\u04c0\34\155\1\356\17\155\1\u04c1\31\155\1\356\14\155"+
-    "\1\u04c2\22\155\1\u0475\2\155\1\u0475\4\155\1\u0334\1\155"+
-    "\1\356\40\155\1\u04c3\10\155\1\356\36\155\2\u0431\3\u0476"+
-    "\1\u0477\5\u0431\1\u0478\1\u0431\1\u04c4\33\u0431\1\155\1\0"+
-    "\1\u047a\1\u0479\1\0\1\u047a\1\u047b\7\0\1\u04c5\36\0"+
-    "\1\u0479\47\0\2\u03dc\4\0\5\u03dc\1\u04c6\1\u03dc\1\u04c7"+
-    "\1\u03dc\1\u0432\31\u03dc\1\0\2\u047d\4\0\5\u047d\1\u04c8"+
-    "\3\u047d\1\u04c9\31\u047d\1\0\2\u047e\1\u03e2\2\0\1\u03e3"+
-    "\11\u047e\1\u04ca\31\u047e\1\0\2\u047f\4\0\5\u047f\1\u04cb"+
-    "\35\u047f\1\0\2\u0480\1\u03e2\2\0\1\u03e3\43\u0480\1\0"+
-    "\2\u0435\1\250\2\0\1\251\5\u0435\1\u0481\1\u0435\1\u0482"+
-    "\1\u0435\1\u0482\31\u0435\1\0\1\u0435\1\u0482\1\u03de\1\0"+
-    "\1\u03df\1\u03e0\5\u0435\1\u0481\1\u0435\1\u04cc\1\u0435\1\u0482"+
-    "\31\u0435\1\0\1\u0436\1\u0483\1\u03de\1\0\1\u03df\1\u03e0"+
-    "\7\u0436\1\u04cd\1\u0436\1\u0483\31\u0436\1\0\2\u0437\4\0"+
-    "\5\u0437\1\u0484\1\u0437\1\u0485\1\u0437\1\u0485\31\u0437\1\0"+
-    "\1\u0437\1\u0485\1\u03e2\1\0\1\u03df\1\u03e3\5\u0437\1\u0484"+
-    "\1\u0437\1\u04ce\1\u0437\1\u0485\31\u0437\1\0\1\u0438\1\u0486"+
-    "\1\u03e2\1\0\1\u03df\1\u03e3\7\u0438\1\u04cf\1\u0438\1\u0486"+
-    "\31\u0438\1\0\2\u0439\1\250\2\0\1\251\5\u0439\1\u0487"+
-    "\1\u0439\1\u0488\1\u0439\1\u0488\31\u0439\1\0\1\u0439\1\u0488"+
-    "\1\u038c\1\0\1\u038d\1\u038e\5\u0439\1\u0487\1\u0439\1\u04d0"+
-    "\1\u0439\1\u0488\31\u0439\1\0\1\u043a\1\u0489\1\u038c\1\0"+
-    "\1\u038d\1\u038e\7\u043a\1\u04d1\1\u043a\1\u0489\31\u043a\2\0"+
-    "\1\u03cc\1\u03e7\1\0\1\u03cc\1\u03e8\2\0\1\262\4\0"+
-    "\1\u03e9\3\0\1\263\1\0\24\263\1\264\1\u03ea\1\0"+
-    "\2\u043c\4\0\5\u043c\1\u048b\1\u043c\1\u04d2\33\u043c\1\0"+
-    "\1\u03eb\1\u048c\1\u038c\1\0\1\u038d\1\u038e\5\u03eb\1\u043e"+
-    "\1\u03eb\1\u04d3\33\u03eb\1\0\2\u048d\1\u04d4\45\u048d\1\0"+
-    "\1\u048d\41\0\1\u04d5\52\0\1\u04d6\44\0\1\u04d7\55\0"+
-    "\1\u04d8\43\0\1\u04d9\16\0\7\136\1\23\12\136\1\137"+
-    "\20\136\1\u04da\15\136\1\23\12\136\1\137\17\136\1\u04db"+
-    "\16\136\1\23\12\136\1\137\1\136\1\u04dc\34\136\1\23"+
-    "\12\136\1\137\5\136\1\u04dd\30\136\1\23\12\136\1\137"+
-    "\20\136\1\u04de\6\136\13\155\1\356\26\155\1\u04df\22\155"+
-    "\1\356\10\155\1\u04e0\40\155\1\356\22\155\1\u04e1\26\155"+
-    "\1\356\27\155\1\u04e2\21\155\1\356\10\155\1\u04e3\25\155"+
-    "\2\163\1\164\1\50\1\0\1\165\22\163\1\u04e4\20\163"+
-    "\1\50\2\163\1\164\1\50\1\0\1\165\25\163\1\u04e5"+
-    "\15\163\1\50\33\0\1\u04e6\46\0\1\u04e7\21\0\1\u01aa"+
-    "\1\u030a\1\164\1\50\1\231\1\165\11\u01aa\1\u023d\31\u01aa"+
-    "\1\50\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d"+
-    "\16\u01aa\1\u04e8\12\u01aa\1\50\2\u01aa\1\164\1\50\1\0"+
-    "\1\165\11\u01aa\1\u023d\11\u01aa\1\u04e9\17\u01aa\1\50\2\u01aa"+
-    "\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\7\u01aa\1\u04ea"+
-    "\21\u01aa\1\50\1\u01aa\1\u04eb\1\164\1\50\1\u0351\1\165"+
-    "\10\u01aa\1\u04a5\1\u03af\1\u01aa\1\u04a5\1\u01aa\24\u04a5\2\u01aa"+
-    "\1\50\1\u021e\1\u030c\2\0\1\231\1\0\11\u021e\1\u0295"+
-    "\31\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\16\u021e\1\u04ec"+
-    "\12\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\11\u021e\1\u04ed"+
-    "\17\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\7\u021e\1\u04ee"+
-    "\21\u021e\1\0\1\u021e\1\u04ef\2\0\1\u0351\1\0\10\u021e"+
-    "\1\u04aa\1\u03b3\1\u021e\1\u04aa\1\u021e\24\u04aa\2\u021e\1\0"+
-    "\12\u01ae\1\u021f\12\u01ae\1\u04f0\36\u01ae\1\u021f\22\u01ae\1\u04f1"+
-    "\26\u01ae\1\u021f\20\u01ae\1\u04f2\30\u01ae\1\u021f\23\u01ae\1\u04f3"+
-    "\25\u01ae\1\u021f\30\u01ae\1\u04f4\6\u01ae\2\160\3\357\1\360"+
-    "\35\160\1\u04f5\5\160\1\0\2\160\3\357\1\360\34\160"+
-    "\1\u04f6\6\160\1\0\2\160\3\357\1\360\16\160\1\u04f7"+
-    "\24\160\1\0\2\160\3\357\1\360\22\160\1\u04f8\20\160"+
-    "\1\0\2\160\3\357\1\360\35\160\1\u04f9\5\160\2\0"+
-    "\1\u0324\2\0\1\u0324\4\0\1\u0257\76\0\1\u04fa\13\0"+
-    "\2\u0468\1\266\2\0\1\267\5\u0468\1\u04b7\1\u0468\1\u04b8"+
-    "\1\u0468\1\u04b8\31\u0468\1\0\1\u0468\1\u04b8\1\u041e\1\0"+
-    "\1\u03df\1\u041f\5\u0468\1\u04b7\1\u0468\1\u04fb\1\u0468\1\u04b8"+
-    "\31\u0468\1\0\1\u0469\1\u04b9\1\u041e\1\0\1\u03df\1\u041f"+
-    "\7\u0469\1\u04fc\1\u0469\1\u04b9\31\u0469\1\0\2\u046a\1\266"+
-    "\2\0\1\267\5\u046a\1\u04ba\1\u046a\1\u04bb\1\u046a\1\u04bb"+
-    "\31\u046a\1\0\1\u046a\1\u04bb\1\u03cc\1\0\1\u038d\1\u03cd"+
-    "\5\u046a\1\u04ba\1\u046a\1\u04fd\1\u046a\1\u04bb\31\u046a\1\0"+
-    "\1\u046b\1\u04bc\1\u03cc\1\0\1\u038d\1\u03cd\7\u046b\1\u04fe"+
-    "\1\u046b\1\u04bc\31\u046b\1\0\1\u0422\1\u04bd\1\u03cc\1\0"+
-    "\1\u038d\1\u03cd\5\u0422\1\u046c\1\u0422\1\u04ff\33\u0422\1\0"+
-    "\7\136\1\23\12\136\1\137\5\136\1\u0500\30\136\1\23"+
-    "\12\136\1\137\10\136\1\u0501\16\136\1\155\1\u0333\2\155"+
-    "\1\u0333\4\155\1\u0334\1\155\1\356\51\155\1\356\22\155"+
-    "\1\u0502\26\155\1\356\15\155\1\u0503\20\155\13\0\1\u0504"+
-    "\1\0\1\u0505\34\0\2\u04c6\4\0\5\u04c6\1\u0506\3\u04c6"+
-    "\1\u0507\31\u04c6\1\0\2\u04c7\1\u0479\2\0\1\u047b\11\u04c7"+
-    "\1\u0508\31\u04c7\1\0\2\u047d\4\0\5\u047d\1\u04c8\1\u047d"+
-    "\1\u0509\1\u047d\1\u04c9\31\u047d\1\0\1\u047d\1\u04c9\1\u0479"+
-    "\1\0\1\u047a\1\u047b\5\u047d\1\u04c8\1\u047d\1\u050a\1\u047d"+
-    "\1\u04c9\31\u047d\1\0\1\u047e\1\u04ca\1\u03e2\1\0\1\u047a"+
-    "\1\u03e3\7\u047e\1\u050b\1\u047e\1\u04ca\31\u047e\1\0\2\u047f"+
-    "\4\0\5\u047f\1\u04cb\1\u047f\1\u050c\33\u047f\1\0\2\u0435"+
-    "\1\250\2\0\1\251\5\u0435\1\u0481\1\u0435\1\u050d\1\u0435"+
-    "\1\u0482\31\u0435\1\0\2\u0436\1\u03de\2\0\1\u03e0\5\u0436"+
-    "\1\u050d\3\u0436\1\u0483\31\u0436\1\0\2\u0437\4\0\5\u0437"+
-    "\1\u0484\1\u0437\1\u050e\1\u0437\1\u0485\31\u0437\1\0\2\u0438"+
-    "\1\u03e2\2\0\1\u03e3\5\u0438\1\u050e\3\u0438\1\u0486\31\u0438"+
-    "\1\0\2\u0439\1\250\2\0\1\251\5\u0439\1\u0487\1\u0439"+
-    "\1\u050f\1\u0439\1\u0488\31\u0439\1\0\2\u043a\1\u038c\2\0"+
-    "\1\u038e\5\u043a\1\u050f\3\u043a\1\u0489\31\u043a\1\0\1\u043c"+
-    "\1\u04d2\1\u03e7\1\0\1\u038d\1\u03e8\5\u043c\1\u048b\1\u043c"+
-    "\1\u0510\33\u043c\1\0\2\u03eb\1\250\2\0\1\251\5\u03eb"+
-    "\1\u043e\1\u03eb\1\u0511\33\u03eb\1\0\2\u04d4\1\u0512\45\u04d4"+
-    "\1\0\1\u04d4\24\0\1\u0513\26\0\1\u0514\2\0\1\u0514"+
-    "\46\0\1\u0515\2\0\1\u0515\76\0\1\u0516\46\0\1\u0517"+
-    "\23\0\7\136\1\23\12\136\1\137\16\136\1\u0518\17\136"+
-    "\1\23\12\136\1\137\17\136\1\u0519\16\136\1\23\12\136"+
-    "\1\137\12\136\1\u051a\23\136\1\23\12\136\1\137\16\136"+
-    "\1\u051b\17\136\1\23\12\136\1\137\10\136\1\u051c\16\136"+
-    "\13\155\1\356\27\155\1\u051d\21\155\1\356\26\155\1\u051e"+
-    "\22\155\1\356\10\155\1\u051f\40\155\1\356\14\155\1\u0520"+
-    "\34\155\1\356\27\155\1\u0521\6\155\1\163\1\u0350\1\164"+
-    "\1\50\1\u0351\1\165\11\163\1\u01a5\31\163\1\50\2\163"+
-    "\1\164\1\50\1\0\1\165\30\163\1\u0522\12\163\1\50"+
-    "\36\0\1\u0523\14\0\1\u0351\2\0\1\u0351\12\0\1\u01a7"+
-    "\32\0\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d"+
-    "\10\u01aa\1\u0524\20\u01aa\1\50\2\u01aa\1\164\1\50\1\0"+
-    "\1\165\11\u01aa\1\u023d\13\u01aa\1\u0525\15\u01aa\1\50\2\u01aa"+
-    "\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\10\u01aa\1\u0526"+
-    "\20\u01aa\1\50\1\u01aa\1\u04eb\1\164\1\50\1\u0351\1\165"+
-    "\2\u01aa\1\u0527\6\u01aa\1\u023d\1\u0409\1\u0528\1\u01aa\24\u0528"+
-    "\2\u01aa\1\50\2\u021e\4\0\11\u021e\1\u0295\10\u021e\1\u0529"+
-    "\20\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\13\u021e\1\u052a"+
-    "\15\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\10\u021e\1\u052b"+
-    "\20\u021e\1\0\1\u021e\1\u04ef\2\0\1\u0351\1\0\2\u021e"+
-    "\1\u052c\6\u021e\1\u0295\1\u040e\1\u052d\1\u021e\24\u052d\2\u021e"+
-    "\1\0\12\u01ae\1\u021f\27\u01ae\1\u052e\21\u01ae\1\u021f\11\u01ae"+
-    "\1\u052f\37\u01ae\1\u021f\23\u01ae\1\u0530\25\u01ae\1\u021f\30\u01ae"+
-    "\1\u0531\20\u01ae\1\u021f\11\u01ae\1\u0532\25\u01ae\2\160\3\357"+
-    "\1\360\33\160\1\u0533\7\160\1\0\2\160\3\357\1\360"+
-    "\34\160\1\u0534\6\160\1\0\2\160\3\357\1\360\27\160"+
-    "\1\u0535\13\160\1\0\2\160\3\357\1\360\33\160\1\u0536"+
-    "\7\160\1\0\2\160\3\357\1\360\25\160\1\u0537\15\160"+
-    "\31\0\1\u03c6\21\0\2\u0468\1\266\2\0\1\267\5\u0468"+
-    "\1\u04b7\1\u0468\1\u0538\1\u0468\1\u04b8\31\u0468\1\0\2\u0469"+
-    "\1\u041e\2\0\1\u041f\5\u0469\1\u0538\3\u0469\1\u04b9\31\u0469"+
-    "\1\0\2\u046a\1\266\2\0\1\267\5\u046a\1\u04ba\1\u046a"+
-    "\1\u0539\1\u046a\1\u04bb\31\u046a\1\0\2\u046b\1\u03cc\2\0"+
-    "\1\u03cd\5\u046b\1\u0539\3\u046b\1\u04bc\31\u046b\1\0\2\u0422"+
-    "\1\266\2\0\1\267\5\u0422\1\u046c\1\u0422\1\u053a\33\u0422"+
-    "\1\0\1\136\1\u037c\2\136\1\u037c\2\136\1\23\1\136"+
-    "\1\u02d5\10\136\1\137\36\136\1\23\12\136\1\137\13\136"+
-    "\1\u053b\13\136\13\155\1\356\14\155\1\u053c\34\155\1\356"+
-    "\17\155\1\u053d\16\155\2\u0504\4\0\5\u0504\1\u053e\35\u0504"+
-    "\1\0\2\u0505\1\u0479\2\0\1\u047b\43\u0505\1\0\2\u04c6"+
-    "\4\0\5\u04c6\1\u0506\1\u04c6\1\u0507\1\u04c6\1\u0507\31\u04c6"+
-    "\1\0\1\u04c6\1\u0507\1\u0479\1\0\1\u047a\1\u047b\5\u04c6"+
-    "\1\u0506\1\u04c6\1\u053f\1\u04c6\1\u0507\31\u04c6\1\0\1\u04c7"+
-    "\1\u0508\1\u0479\1\0\1\u047a\1\u047b\7\u04c7\1\u0540\1\u04c7"+
-    "\1\u0508\31\u04c7\1\0\1\u047d\1\u0509\1\u03e2\1\0\1\u03df"+
-    "\1\u03e3\5\u047d\1\u04c8\1\u047d\1\u0541\1\u047d\1\u04c9\31\u047d"+
-    "\1\0\2\u047d\4\0\5\u047d\1\u04c8\1\u047d\1\u0542\1\u047d"+
-    "\1\u04c9\31\u047d\1\0\2\u047e\1\u03e2\2\0\1\u03e3\5\u047e"+
-    "\1\u0543\3\u047e\1\u04ca\31\u047e\1\0\1\u047f\1\u050c\1\u03e2"+
-    "\1\0\1\u03df\1\u03e3\5\u047f\1\u04cb\1\u047f\1\u0544\33\u047f"+
-    "\1\0\2\u050d\1\u03de\2\0\1\u03e0\5\u050d\1\u0545\3\u050d"+
-    "\1\u0546\31\u050d\1\0\2\u050e\1\u03e2\2\0\1\u03e3\5\u050e"+
-    "\1\u0547\3\u050e\1\u0548\31\u050e\1\0\2\u050f\1\u038c\2\0"+
-    "\1\u038e\5\u050f\1\u0549\3\u050f\1\u054a\31\u050f\1\0\2\u043c"+
-    "\4\0\5\u043c\1\u048b\1\u043c\1\u054b\33\u043c\1\0\2\u0511"+
-    "\1\u038c\2\0\1\u038e\5\u0511\1\u054c\35\u0511\1\0\2\u0512"+
-    "\1\u054d\45\u0512\1\0\1\u0512\26\0\1\u054e\24\0\1\u0514"+
-    "\2\0\1\u0514\11\0\1\u054f\2\0\1\u054f\2\0\23\u054f"+
-    "\4\0\1\u0515\2\0\1\u0515\21\0\1\u0396\4\0\1\u0398"+
-    "\42\0\1\u0550\26\0\1\u0551\2\0\1\u0551\45\0\7\136"+
-    "\1\23\12\136\1\137\1\136\1\u0552\26\136\1\u0553\2\136"+
-    "\1\u0553\2\136\1\23\12\136\1\137\30\136\1\u0554\2\136"+
-    "\1\u0554\2\136\1\23\12\136\1\137\36\136\1\23\12\136"+
-    "\1\137\6\136\1\u0555\27\136\1\23\12\136\1\137\3\136"+
-    "\1\u0556\23\136\13\155\1\356\25\155\1\u0557\23\155\1\356"+
-    "\26\155\1\u0558\22\155\1\356\21\155\1\u0559\27\155\1\356"+
-    "\25\155\1\u055a\23\155\1\356\17\155\1\u055b\16\155\2\163"+
-    "\1\164\1\50\1\0\1\165\22\163\1\u055c\20\163\1\50"+
-    "\30\0\1\u055d\21\0\1\u01aa\1\u03ae\1\164\1\50\1\u01a4"+
-    "\1\165\11\u01aa\1\u03af\31\u01aa\1\50\2\u01aa\1\164\1\50"+
-    "\1\0\1\165\11\u01aa\1\u023d\16\u01aa\1\u055e\12\u01aa\1\50"+
-    "\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\11\u01aa"+
-    "\1\u055f\17\u01aa\1\50\2\u01aa\1\164\1\50\1\0\1\165"+
-    "\11\u01aa\1\u023d\7\u01aa\1\u0560\21\u01aa\1\50\1\u01aa\1\u0561"+
-    "\1\164\1\50\1\u0402\1\165\10\u01aa\1\u0528\1\u03af\1\u01aa"+
-    "\1\u0528\1\u01aa\24\u0528\2\u01aa\1\50\1\u021e\1\u03b2\2\0"+
-    "\1\u01a4\1\0\11\u021e\1\u03b3\31\u021e\1\0\2\u021e\4\0"+
-    "\11\u021e\1\u0295\16\u021e\1\u0562\12\u021e\1\0\2\u021e\4\0"+
-    "\11\u021e\1\u0295\11\u021e\1\u0563\17\u021e\1\0\2\u021e\4\0"+
-    "\11\u021e\1\u0295\7\u021e\1\u0564\21\u021e\1\0\1\u021e\1\u0565"+
-    "\2\0\1\u0402\1\0\10\u021e\1\u052d\1\u03b3\1\u021e\1\u052d"+
-    "\1\u021e\24\u052d\2\u021e\1\0\12\u01ae\1\u021f\30\u01ae\1\u0566"+
-    "\20\u01ae\1\u021f\27\u01ae\1\u0567\21\u01ae\1\u021f\11\u01ae\1\u0568"+
-    "\37\u01ae\1\u021f\15\u01ae\1\u0569\33\u01ae\1\u021f\30\u01ae\1\u056a"+
-    "\6\u01ae\2\160\3\357\1\360\16\160\1\u056b\24\160\1\0"+
-    "\1\160\1\u056c\2\357\1\u056d\1\360\43\160\1\0\1\160"+
-    "\1\u056e\2\357\1\u056f\1\360\43\160\1\0\2\160\3\357"+
-    "\1\360\23\160\1\u0570\17\160\1\0\2\160\3\357\1\360"+
-    "\20\160\1\u0571\22\160\1\0\2\u0538\1\u041e\2\0\1\u041f"+
-    "\5\u0538\1\u0572\3\u0538\1\u0573\31\u0538\1\0\2\u0539\1\u03cc"+
-    "\2\0\1\u03cd\5\u0539\1\u0574\3\u0539\1\u0575\31\u0539\1\0"+
-    "\2\u053a\1\u03cc\2\0\1\u03cd\5\u053a\1\u0576\35\u053a\1\0"+
-    "\7\136\1\23\12\136\1\137\5\136\1\u0427\21\136\1\155"+
-    "\1\u03d8\2\155\1\u03d8\4\155\1\u0334\1\155\1\356\51\155"+
-    "\1\356\22\155\1\u0577\13\155\2\u0504\4\0\5\u0504\1\u053e"+
-    "\1\u0504\1\u0578\33\u0504\1\0\2\u04c6\4\0\5\u04c6\1\u0506"+
-    "\1\u04c6\1\u0579\1\u04c6\1\u0507\31\u04c6\1\0\2\u04c7\1\u0479"+
-    "\2\0\1\u047b\5\u04c7\1\u0579\3\u04c7\1\u0508\31\u04c7\1\0"+
-    "\2\u047d\4\0\5\u047d\1\u04c8\1\u047d\1\u057a\1\u047d\1\u04c9"+
-    "\31\u047d\1\0\2\u0542\1\u0479\2\0\1\u047b\5\u0542\1\u057b"+
-    "\3\u0542\1\u057c\31\u0542\1\0\2\u0543\1\u03e2\2\0\1\u03e3"+
-    "\5\u0543\1\u057d\3\u0543\1\u057e\31\u0543\1\0\2\u047f\4\0"+
-    "\5\u047f\1\u04cb\1\u047f\1\u057f\33\u047f\1\0\2\u050d\1\u03de"+
-    "\2\0\1\u03e0\5\u050d\1\u0545\1\u050d\1\u0546\1\u050d\1\u0546"+
-    "\31\u050d\1\0\1\u050d\1\u0546\1\u03de\1\0\1\u03df\1\u03e0"+
-    "\5\u050d\1\u0545\3\u050d\1\u0546\31\u050d\1\0\2\u050e\1\u03e2"+
-    "\2\0\1\u03e3\5\u050e\1\u0547\1\u050e\1\u0548\1\u050e\1\u0548"+
-    "\31\u050e\1\0\1\u050e\1\u0548\1\u03e2\1\0\1\u03df\1\u03e3"+
-    "\5\u050e\1\u0547\3\u050e\1\u0548\31\u050e\1\0\2\u050f\1\u038c"+
-    "\2\0\1\u038e\5\u050f\1\u0549\1\u050f\1\u054a\1\u050f\1\u054a"+
-    "\31\u050f\1\0\1\u050f\1\u054a\1\u038c\1\0\1\u038d\1\u038e"+
-    "\5\u050f\1\u0549\3\u050f\1\u054a\31\u050f\1\0\2\u054b\1\u03e7"+
-    "\2\0\1\u03e8\5\u054b\1\u0580\35\u054b\1\0\2\u0511\1\u038c"+
-    "\2\0\1\u038e\5\u0511\1\u054c\1\u0511\1\u0581\33\u0511\1\0"+
-    "\2\u0512\1\u054d\45\u0512\1\u0582\1\u0512\43\0\1\u0583\24\0"+
-    "\1\u054f\2\0\1\u054f\2\0\23\u054f\31\0\1\u0584\24\0"+
-    "\1\u0551\2\0\1\u0551\21\0\1\u0396\2\0\1\u0397\1\0"+
-    "\1\u0398\16\0\7\136\1\23\12\136\1\137\3\136\1\u0585"+
-    "\24\136\1\u0553\2\136\1\u0553\2\136\1\23\6\136\1\u0586"+
-    "\2\136\1\u0586\1\137\1\136\23\u0586\4\136\1\u0554\2\136"+
-    "\1\u0554\2\136\1\23\12\136\1\137\3\136\1\u03f9\4\136"+
-    "\1\u03fb\25\136\1\23\12\136\1\137\1\136\1\u0587\26\136"+
-    "\1\u0588\2\136\1\u0588\2\136\1\23\12\136\1\137\27\136"+
-    "\13\155\1\356\10\155\1\u0589\26\155\1\u058a\2\155\1\u058a"+
-    "\6\155\1\356\37\155\1\u058b\2\155\1\u058b\6\155\1\356"+
-    "\51\155\1\356\15\155\1\u058c\33\155\1\356\12\155\1\u058d"+
-    "\23\155\1\163\1\u0401\1\164\1\50\1\u0402\1\165\11\163"+
-    "\1\u01a5\31\163\1\50\1\0\1\u0402\2\0\1\u0402\12\0"+
-    "\1\u01a7\32\0\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa"+
-    "\1\u023d\10\u01aa\1\u058e\20\u01aa\1\50\2\u01aa\1\164\1\50"+
-    "\1\0\1\165\11\u01aa\1\u023d\13\u01aa\1\u058f\15\u01aa\1\50"+
-    "\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\10\u01aa"+
-    "\1\u0590\20\u01aa\1\50\1\u01aa\1\u0561\1\164\1\50\1\u0402"+
-    "\1\165\11\u01aa\1\u023d\1\u0409\30\u01aa\1\50\2\u021e\4\0"+
-    "\11\u021e\1\u0295\10\u021e\1\u0591\20\u021e\1\0\2\u021e\4\0"+
-    "\11\u021e\1\u0295\13\u021e\1\u0592\15\u021e\1\0\2\u021e\4\0"+
-    "\11\u021e\1\u0295\10\u021e\1\u0593\20\u021e\1\0\1\u021e\1\u0565"+
-    "\2\0\1\u0402\1\0\11\u021e\1\u0295\1\u040e\30\u021e\1\0"+
-    "\12\u01ae\1\u021f\26\u01ae\1\u0594\22\u01ae\1\u021f\27\u01ae\1\u0595"+
-    "\21\u01ae\1\u021f\22\u01ae\1\u0596\26\u01ae\1\u021f\26\u01ae\1\u0597"+
-    "\22\u01ae\1\u021f\20\u01ae\1\u0598\16\u01ae\2\160\3\357\1\360"+
-    "\20\160\1\u0599\22\160\1\0\1\160\1\u056c\2\357\1\u056d"+
-    "\1\360\10\160\1\u059a\2\160\1\u059a\2\160\23\u059a\2\160"+
-    "\1\0\1\160\1\u056e\2\357\1\u056f\1\360\20\160\1\u0416"+
-    "\4\160\1\u0418\15\160\1\0\2\160\3\357\1\360\16\160"+
-    "\1\u059b\24\160\1\0\1\160\1\u059c\2\357\1\u059d\1\360"+
-    "\43\160\1\0\2\u0538\1\u041e\2\0\1\u041f\5\u0538\1\u0572"+
-    "\1\u0538\1\u0573\1\u0538\1\u0573\31\u0538\1\0\1\u0538\1\u0573"+
-    "\1\u041e\1\0\1\u03df\1\u041f\5\u0538\1\u0572\3\u0538\1\u0573"+
-    "\31\u0538\1\0\2\u0539\1\u03cc\2\0\1\u03cd\5\u0539\1\u0574"+
-    "\1\u0539\1\u0575\1\u0539\1\u0575\31\u0539\1\0\1\u0539\1\u0575"+
-    "\1\u03cc\1\0\1\u038d\1\u03cd\5\u0539\1\u0574\3\u0539\1\u0575"+
-    "\31\u0539\1\0\2\u053a\1\u03cc\2\0\1\u03cd\5\u053a\1\u0576"+
-    "\1\u053a\1\u059e\33\u053a\1\0\13\155\1\356\14\155\1\u0475"+
-    "\21\155\1\u0504\1\u0578\1\u0479\1\0\1\u047a\1\u047b\5\u0504"+
-    "\1\u053e\1\u0504\1\u059f\33\u0504\1\0\2\u0579\1\u0479\2\0"+
-    "\1\u047b\5\u0579\1\u05a0\3\u0579\1\u05a1\31\u0579\1\0\2\u057a"+
-    "\1\u03e2\2\0\1\u03e3\5\u057a\1\u05a2\3\u057a\1\u05a3\31\u057a"+
-    "\1\0\2\u0542\1\u0479\2\0\1\u047b\5\u0542\1\u057b\1\u0542"+
-    "\1\u05a4\1\u0542\1\u057c\31\u0542\1\0\1\u0542\1\u057c\1\u0479"+
-    "\1\0\1\u047a\1\u047b\5\u0542\1\u057b\3\u0542\1\u057c\31\u0542"+
-    "\1\0\2\u0543\1\u03e2\2\0\1\u03e3\5\u0543\1\u057d\1\u0543"+
-    "\1\u057e\1\u0543\1\u057e\31\u0543\1\0\1\u0543\1\u057e\1\u03e2"+
-    "\1\0\1\u047a\1\u03e3\5\u0543\1\u057d\3\u0543\1\u057e\31\u0543"+
-    "\1\0\2\u057f\1\u03e2\2\0\1\u03e3\5\u057f\1\u05a5\35\u057f"+
-    "\1\0\2\u054b\1\u03e7\2\0\1\u03e8\5\u054b\1\u0580\1\u054b"+
-    "\1\u05a6\33\u054b\1\0\1\u0511\1\u0581\1\u038c\1\0\1\u038d"+
-    "\1\u038e\5\u0511\1\u054c\35\u0511\1\0\2\u0582\3\u05a7\1\u05a8"+
-    "\43\u0582\2\0\1\u05a9\2\0\1\u05a9\75\0\1\u04d6\21\0"+
-    "\7\136\1\23\12\136\1\137\20\136\1\u05aa\15\136\1\23"+
-    "\6\136\1\u0586\2\136\1\u0586\1\137\1\136\23\u0586\12\136"+
-    "\1\23\12\136\1\137\3\136\1\u05ab\24\136\1\u0588\2\136"+
-    "\1\u0588\2\136\1\23\12\136\1\137\3\136\1\u03f9\2\136"+
-    "\1\u03fa\1\136\1\u03fb\16\136\13\155\1\356\12\155\1\u05ac"+
-    "\24\155\1\u058a\2\155\1\u058a\6\155\1\356\2\155\1\u05ad"+
-    "\2\155\1\u05ad\2\155\23\u05ad\4\155\1\u058b\2\155\1\u058b"+
-    "\6\155\1\356\12\155\1\u044d\4\155\1\u044f\31\155\1\356"+
-    "\10\155\1\u05ae\26\155\1\u05af\2\155\1\u05af\6\155\1\356"+
-    "\36\155\1\u01aa\1\u045a\1\164\1\50\1\u02ac\1\165\11\u01aa"+
-    "\1\u03af\31\u01aa\1\50\2\u01aa\1\164\1\50\1\0\1\165"+
-    "\11\u01aa\1\u023d\16\u01aa\1\u05b0\12\u01aa\1\50\2\u01aa\1\164"+
-    "\1\50\1\0\1\165\11\u01aa\1\u023d\11\u01aa\1\u05b1\17\u01aa"+
-    "\1\50\1\u021e\1\u045e\2\0\1\u02ac\1\0\11\u021e\1\u03b3"+
-    "\31\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\16\u021e\1\u05b2"+
-    "\12\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295\11\u021e\1\u05b3"+
-    "\17\u021e\1\0\12\u01ae\1\u021f\11\u01ae\1\u05b4\26\u01ae\1\u05b5"+
-    "\2\u01ae\1\u05b5\5\u01ae\1\u021f\40\u01ae\1\u05b6\2\u01ae\1\u05b6"+
-    "\5\u01ae\1\u021f\51\u01ae\1\u021f\16\u01ae\1\u05b7\32\u01ae\1\u021f"+
-    "\13\u01ae\1\u05b8\23\u01ae\2\160\3\357\1\360\35\160\1\u05b9"+
-    "\5\160\1\0\2\160\3\357\1\360\10\160\1\u059a\2\160"+
-    "\1\u059a\2\160\23\u059a\2\160\1\0\2\160\3\357\1\360"+
-    "\20\160\1\u05ba\22\160\1\0\1\160\1\u059c\2\357\1\u059d"+
-    "\1\360\20\160\1\u0416\2\160\1\u0417\1\160\1\u0418\15\160"+
-    "\1\0\1\u053a\1\u059e\1\u03cc\1\0\1\u038d\1\u03cd\5\u053a"+
-    "\1\u0576\35\u053a\1\0\2\u0504\4\0\5\u0504\1\u053e\1\u0504"+
-    "\1\u05bb\33\u0504\1\0\2\u0579\1\u0479\2\0\1\u047b\5\u0579"+
-    "\1\u05a0\1\u0579\1\u05a1\1\u0579\1\u05a1\31\u0579\1\0\1\u0579"+
-    "\1\u05a1\1\u0479\1\0\1\u047a\1\u047b\5\u0579\1\u05a0\3\u0579"+
-    "\1\u05a1\31\u0579\1\0\2\u057a\1\u03e2\2\0\1\u03e3\5\u057a"+
-    "\1\u05a2\1\u057a\1\u05bc\1\u057a\1\u05a3\31\u057a\1\0\1\u057a"+
-    "\1\u05a3\1\u03e2\1\0\1\u047a\1\u03e3\5\u057a\1\u05a2\3\u057a"+
-    "\1\u05a3\31\u057a\1\0\1\u0542\1\u05a4\1\u03e2\1\0\1\u03df"+
-    "\1\u03e3\5\u0542\1\u057b\1\u0542\1\u05bd\1\u0542\1\u057c\31\u0542"+
-    "\1\0\2\u057f\1\u03e2\2\0\1\u03e3\5\u057f\1\u05a5\1\u057f"+
-    "\1\u05be\33\u057f\1\0\1\u054b\1\u05a6\1\u03e7\1\0\1\u038d"+
-    "\1\u03e8\5\u054b\1\u0580\35\u054b\3\0\1\u05bf\50\0\1\u05a9"+
-    "\2\0\1\u05a9\21\0\1\u0396\2\0\1\u0397\1\0\1\u0398"+
-    "\6\0\1\u0399\7\0\1\136\1\u05c0\2\136\1\u05c0\2\136"+
-    "\1\23\12\136\1\137\36\136\1\23\12\136\1\137\5\136"+
-    "\1\u0519\21\136\13\155\1\356\27\155\1\u05c1\21\155\1\356"+
-    "\2\155\1\u05ad\2\155\1\u05ad\2\155\23\u05ad\16\155\1\356"+
-    "\12\155\1\u05c2\24\155\1\u05af\2\155\1\u05af\6\155\1\356"+
-    "\12\155\1\u044d\2\155\1\u044e\1\155\1\u044f\16\155\2\u01aa"+
-    "\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\10\u01aa\1\u05c3"+
-    "\20\u01aa\1\50\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa"+
-    "\1\u023d\13\u01aa\1\u05c4\15\u01aa\1\50\2\u021e\4\0\11\u021e"+
-    "\1\u0295\10\u021e\1\u05c5\20\u021e\1\0\2\u021e\4\0\11\u021e"+
-    "\1\u0295\13\u021e\1\u05c6\15\u021e\1\0\12\u01ae\1\u021f\13\u01ae"+
-    "\1\u05c7\24\u01ae\1\u05b5\2\u01ae\1\u05b5\5\u01ae\1\u021f\3\u01ae"+
-    "\1\u05c8\2\u01ae\1\u05c8\2\u01ae\23\u05c8\4\u01ae\1\u05b6\2\u01ae"+
-    "\1\u05b6\5\u01ae\1\u021f\13\u01ae\1\u04ac\4\u01ae\1\u04ae\30\u01ae"+
-    "\1\u021f\11\u01ae\1\u05c9\26\u01ae\1\u05ca\2\u01ae\1\u05ca\5\u01ae"+
-    "\1\u021f\37\u01ae\1\160\1\u05cb\2\357\1\u05cc\1\360\43\160"+
-    "\1\0\2\160\3\357\1\360\22\160\1\u0534\20\160\1\0"+
-    "\2\u05bb\1\u0479\2\0\1\u047b\5\u05bb\1\u05cd\35\u05bb\1\0"+
-    "\1\u057a\1\u05bc\1\u03e2\1\0\1\u03df\1\u03e3\5\u057a\1\u05a2"+
-    "\3\u057a\1\u05a3\31\u057a\1\0\2\u0542\1\u0479\2\0\1\u047b"+
-    "\5\u0542\1\u057b\1\u0542\1\u057a\1\u0542\1\u057c\31\u0542\1\0"+
-    "\1\u057f\1\u05be\1\u03e2\1\0\1\u03df\1\u03e3\5\u057f\1\u05a5"+
-    "\35\u057f\1\0\1\136\1\u05c0\2\136\1\u05c0\2\136\1\23"+
-    "\12\136\1\137\3\136\1\u03f9\2\136\1\u03fa\1\136\1\u03fb"+
-    "\6\136\1\u03fc\7\136\1\155\1\u05ce\2\155\1\u05ce\6\155"+
-    "\1\356\51\155\1\356\14\155\1\u0558\21\155\1\u01aa\1\u04eb"+
-    "\1\164\1\50\1\u0351\1\165\11\u01aa\1\u03af\31\u01aa\1\50"+
-    "\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d\16\u01aa"+
-    "\1\u05cf\12\u01aa\1\50\1\u021e\1\u04ef\2\0\1\u0351\1\0"+
-    "\11\u021e\1\u03b3\31\u021e\1\0\2\u021e\4\0\11\u021e\1\u0295"+
-    "\16\u021e\1\u05d0\12\u021e\1\0\12\u01ae\1\u021f\30\u01ae\1\u05d1"+
-    "\20\u01ae\1\u021f\3\u01ae\1\u05c8\2\u01ae\1\u05c8\2\u01ae\23\u05c8"+
-    "\15\u01ae\1\u021f\13\u01ae\1\u05d2\24\u01ae\1\u05ca\2\u01ae\1\u05ca"+
-    "\5\u01ae\1\u021f\13\u01ae\1\u04ac\2\u01ae\1\u04ad\1\u01ae\1\u04ae"+
-    "\16\u01ae\1\160\1\u05cb\2\357\1\u05cc\1\360\20\160\1\u0416"+
-    "\2\160\1\u0417\1\160\1\u0418\6\160\1\u0419\6\160\1\0"+
-    "\2\u05bb\1\u0479\2\0\1\u047b\5\u05bb\1\u05cd\1\u05bb\1\u05d3"+
-    "\33\u05bb\1\0\1\155\1\u05ce\2\155\1\u05ce\6\155\1\356"+
-    "\12\155\1\u044d\2\155\1\u044e\1\155\1\u044f\6\155\1\u0450"+
-    "\7\155\2\u01aa\1\164\1\50\1\0\1\165\11\u01aa\1\u023d"+
-    "\10\u01aa\1\u05d4\20\u01aa\1\50\2\u021e\4\0\11\u021e\1\u0295"+
-    "\10\u021e\1\u05d5\20\u021e\1\0\1\u01ae\1\u05d6\2\u01ae\1\u05d6"+
-    "\5\u01ae\1\u021f\51\u01ae\1\u021f\15\u01ae\1\u0595\21\u01ae\1\u05bb"+
-    "\1\u05d3\1\u0479\1\0\1\u047a\1\u047b\5\u05bb\1\u05cd\35\u05bb"+
-    "\1\0\1\u01aa\1\u0561\1\164\1\50\1\u0402\1\165\11\u01aa"+
-    "\1\u03af\31\u01aa\1\50\1\u021e\1\u0565\2\0\1\u0402\1\0"+
-    "\11\u021e\1\u03b3\31\u021e\1\0\1\u01ae\1\u05d6\2\u01ae\1\u05d6"+
-    "\5\u01ae\1\u021f\13\u01ae\1\u04ac\2\u01ae\1\u04ad\1\u01ae\1\u04ae"+
-    "\6\u01ae\1\u04af\7\u01ae";
-
-  private static int [] zzUnpacktrans() {
-    int [] result = new int[55356];
-    int offset = 0;
-    offset = zzUnpacktrans(ZZ_TRANS_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpacktrans(String packed, int offset, int [] result) {
-    int i = 0;       /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length();
-    while (i < l) {
-      int count = packed.charAt(i++);
-      int value = packed.charAt(i++);
-      value--;
-      do result[j++] = value; while (--count > 0);
-    }
-    return j;
-  }
+  private static final int [] ZZ_TRANS = ScannerTables.TRANS;
 
 
   /** Error code for "Unknown internal scanner error". */
@@ -1813,60 +149,7 @@ public class Scanner {
   /**
    * ZZ_ATTRIBUTE[aState] contains the attributes of state {@code aState}
    */
-  private static final int [] ZZ_ATTRIBUTE = zzUnpackAttribute();
-
-  private static final String ZZ_ATTRIBUTE_PACKED_0 =
-    "\20\0\1\11\1\0\1\11\1\0\3\1\1\0\7\1"+
-    "\1\0\7\1\3\0\12\1\1\11\1\0\6\1\2\0"+
-    "\12\1\3\0\1\11\2\0\1\1\1\0\1\11\1\1"+
-    "\11\0\1\11\1\1\45\0\2\11\71\0\1\1\3\0"+
-    "\1\1\14\0\1\11\3\1\4\0\1\11\1\1\1\11"+
-    "\20\0\1\11\2\1\2\0\1\11\1\1\33\0\1\1"+
-    "\6\0\3\1\7\0\1\1\2\0\1\11\7\0\1\1"+
-    "\13\0\1\11\1\1\12\0\1\1\3\0\2\1\17\0"+
-    "\2\1\3\0\1\11\1\0\1\11\2\1\13\0\4\1"+
-    "\3\0\1\1\6\0\1\11\1\1\1\0\2\11\15\0"+
-    "\1\1\12\0\1\1\11\0\1\1\1\0\1\1\3\0"+
-    "\1\1\1\0\1\11\34\0\1\11\10\0\3\1\5\0"+
-    "\2\1\7\0\1\1\6\0\1\1\1\11\1\0\2\1"+
-    "\1\0\1\1\1\0\1\11\1\1\1\0\1\1\2\0"+
-    "\4\1\2\0\1\1\4\0\2\1\1\0\1\1\4\0"+
-    "\3\1\3\0\3\1\2\0\1\1\23\0\1\1\14\0"+
-    "\1\1\31\0\2\1\5\0\1\11\15\0\2\1\3\0"+
-    "\2\1\1\0\1\1\6\0\1\1\1\0\1\1\4\0"+
-    "\1\1\3\0\2\1\1\0\2\1\1\0\1\1\2\0"+
-    "\3\1\1\0\2\1\1\0\1\1\2\0\1\11\13\0"+
-    "\2\1\45\0\1\1\2\0\1\1\25\0\2\1\1\0"+
-    "\1\11\1\1\25\0\1\11\5\0\2\1\61\0\1\1"+
-    "\10\0\1\11\44\0\5\1\37\0\1\1\33\0\1\11"+
-    "\1\1\22\0\1\1\3\0\1\1\1\0\1\1\13\0"+
-    "\1\1\5\0\1\11\1\1\22\0\1\1\2\0\1\1"+
-    "\3\0\1\1\7\0\1\11\3\0\1\11\1\1\6\0"+
-    "\1\11\22\0\1\1\4\0\1\1\4\0\1\11\11\0"+
-    "\1\11\1\1\11\0\3\1\25\0\1\11\57\0\2\1"+
-    "\4\0\2\1\1\0\1\11\111\0\2\1\212\0\1\1"+
-    "\35\0\1\1\1\0\1\1\26\0\1\1\23\0\1\1"+
-    "\2\0\1\1\11\0\1\11\1\1\4\0\1\1\21\0"+
-    "\1\11\10\0\1\1\3\0\1\1\12\0";
-
-  private static int [] zzUnpackAttribute() {
-    int [] result = new int[1494];
-    int offset = 0;
-    offset = zzUnpackAttribute(ZZ_ATTRIBUTE_PACKED_0, offset, result);
-    return result;
-  }
-
-  private static int zzUnpackAttribute(String packed, int offset, int [] result) {
-    int i = 0;       /* index in packed string  */
-    int j = offset;  /* index in unpacked array */
-    int l = packed.length();
-    while (i < l) {
-      int count = packed.charAt(i++);
-      int value = packed.charAt(i++);
-      do result[j++] = value; while (--count > 0);
-    }
-    return j;
-  }
+  private static final int [] ZZ_ATTRIBUTE = ScannerTables.ATTRIBUTE;
 
   /** Input device. */
   private java.io.Reader zzReader;
@@ -1958,6 +241,226 @@ public class Scanner {
 
     boolean isJava = false;
 
+    boolean verbose = true; // prints "Starting Pass N" as each pass
+                            // begins; batch drivers turn it off
+
+    ScanObserver observer = null; // told about every match of an
+                                  // expensive rule; null unless the
+                                  // run is being profiled
+    int pushbackCount = 0; // characters pushed back so far
+
+    void pushback(int number)
+    {
+        pushbackCount += number;
+        yypushback(number);
+    }
+
+    void ruleStarted()
+    {
+        if (observer != null)
+        {
+            observer.ruleStarted();
+        }
+    }
+
+    Token ruleFinished(String rule, Token token)
+    {
+        if (observer != null)
+        {
+            observer.ruleFinished(rule, yyline + 1, yylength(), token);
+        }
+        return token;
+    }
+
+    ArrayDeque<Token> pending = new ArrayDeque<>(); // findings of a
+                                                    // match besides the
+                                                    // one it returned
+
+    /**
+     * Returns the next finding: first any that an action left pending,
+     * then whatever the next match returns.
+     */
+    public Token nextToken() throws IOException
+    {
+        if (pending.isEmpty())
+        {
+            pending.add(scan());
+        }
+        return pending.poll();
+    }
+
+    ArrayList<Loop> loops = new ArrayList<>(); // for loops whose body
+                                               // is being read in PASS1
+
+    static class Loop
+    {
+        final String iterator;
+        final int depth; // indentCount of the header
+        boolean opened = false; // true once its '{' has been read
+
+        Loop (String iterator, int depth)
+        {
+            this.iterator = iterator;
+            this.depth = depth;
+        }
+    }
+
+    /**
+     * Follows the bodies of for loops through PASS1, after its brace
+     * count is updated for the line, and reports lines of a body that
+     * change the loop's iterator. A loop without braces ends after one
+     * line. Costs nothing but two checks on lines outside of loops.
+     */
+    void trackLoops(String code, int line)
+    {
+        if (code.isEmpty())
+        {
+            return;
+        }
+        if (!loops.isEmpty())
+        {
+            Loop innermost = loops.get(loops.size() - 1);
+            if (!innermost.opened && code.startsWith("{"))
+            {
+                innermost.opened = true;
+                return;
+            }
+            if (innermost.opened && code.startsWith("}")
+                && indentCount == innermost.depth)
+            {
+                loops.remove(loops.size() - 1);
+                return;
+            }
+            for (Loop loop : loops)
+            {
+                if (ForHeader.modifies(code, loop.iterator))
+                {
+                    pending.add(new Token("Loop iterator " + loop.iterator
+                        + " is modified within the loop", line, true));
+                }
+            }
+            if (!innermost.opened)
+            {
+                loops.remove(loops.size() - 1);
+            }
+        }
+        ForHeader header = code.startsWith("for")
+            ? ForHeader.parse(code) : null;
+        String problem = header == null ? null : header.whileLoopProblem();
+        if (problem != null)
+        {
+            pending.add(new Token("For loop simulates a while loop: "
+                + problem, line, false));
+        }
+        if (header != null && header.rest.isEmpty())
+        {
+            String iterator = header.initVariable != null
+                ? header.initVariable : header.stepVariable;
+            if (iterator != null)
+            {
+                loops.add(new Loop(iterator, indentCount));
+            }
+        }
+    }
+
+    MixedModeChecker arithmetic = new MixedModeChecker();
+
+    ConstantTable constants = new ConstantTable(); // filled in PASS1,
+                                                   // used in PASS4
+
+    /**
+     * Checks one line of PASS1 for mixed-mode arithmetic.
+     */
+    void checkArithmetic(String code, int line)
+    {
+        String problem = code.isEmpty() ? null : arithmetic.line(code);
+        if (problem != null)
+        {
+            pending.add(new Token(problem, line, false));
+        }
+    }
+
+    /**
+     * Hands one line of code, without its indentation and comments, to
+     * everything that reads the code of PASS1 line by line.
+     */
+    void codeLine(String code, int line)
+    {
+        trackLoops(code, line);
+        checkArithmetic(code, line);
+        constants.line(code, line);
+    }
+
+    /**
+     * Hands the code in front of a block comment to codeLine, since the
+     * comment rules take the whole line, after counting its brace as the
+     * indentation rule does.
+     */
+    void codeBeforeComment(String text, int line)
+    {
+        String code = text.substring(0, text.indexOf("/*")).split("//")[0]
+            .trim();
+        if (code.startsWith("}"))
+        {
+            indentCount--;
+            lastLineComplete = true;
+        }
+        else if (code.equals("{"))
+        {
+            indentCount++;
+            lastLineComplete = true;
+        }
+        codeLine(code, line);
+    }
+
+    ArrayList<FunctionMetrics> functions = null; // filled in PASS6 if
+                                                 // metrics are wanted
+    FunctionMetrics function = null; // the function being read
+    int functionDepth = 0; // size of the stack inside its body
+
+    void functionStarted(String name, int line)
+    {
+        if (functions != null && function == null)
+        {
+            function = new FunctionMetrics(name, line);
+            functionDepth = stack.size();
+        }
+    }
+
+    /**
+     * Ends the current function if the body that PASS6 is about to pop
+     * is its own, and not that of a method of a local or anonymous class
+     * inside it.
+     */
+    void functionEnded(int line)
+    {
+        if (function != null && stack.size() == functionDepth)
+        {
+            function.length = line - function.line + 1;
+            functions.add(function);
+            function = null;
+        }
+    }
+
+    /**
+     * Counts a block that PASS6 just pushed, given the text of its
+     * header, toward the current function's nesting and complexity.
+     */
+    void blockOpened(String header)
+    {
+        if (function != null)
+        {
+            function.maxDepth = Math.max(function.maxDepth,
+                stack.size() - functionDepth);
+            String keyword = header.trim();
+            if (keyword.matches("(?s)(else[ \t\f]+)?if\\b.*")
+                || keyword.matches("(?s)(for|while|switch)\\b.*"))
+            {
+                function.complexity++;
+            }
+        }
+    }
+
     public static class Token
     {
         public final String error;
@@ -1965,6 +468,8 @@ public class Scanner {
         public final boolean sure;
 
         public static final Token NULL = new Token("", -1, false);
+        // returned as each pass but the last ends, after its findings
+        public static final Token PASS_END = new Token("", -1, false);
 
         public Token (String error, int line, boolean sure)
         {
@@ -2171,6 +676,7 @@ public class Scanner {
    * @param newState the new lexical state
    */
   public final void yybegin(int newState) {
+    ScannerTables.load(newState);
     zzLexicalState = newState;
   }
 
@@ -2260,7 +766,7 @@ public class Scanner {
    * @return the next token.
    * @exception java.io.IOException if any I/O-Error occurs.
    */
-  public Token nextToken() throws java.io.IOException
+  public Token scan() throws java.io.IOException
   {
     int zzInput;
     int zzAction;
@@ -2432,38 +938,38 @@ public class Scanner {
         zzAtEOF = true;
             switch (zzLexicalState) {
             case PASS1: {
-              System.out.println("Starting Pass 2");
+              if (verbose) System.out.println("Starting Pass 2");
     resetFileReading();
     yybegin(PASS2);
-    return Token.NULL;
+    return Token.PASS_END;
             }  // fall though
             case 1495: break;
             case PASS2: {
-              System.out.println("Starting Pass 3");
+              if (verbose) System.out.println("Starting Pass 3");
     resetFileReading();
     yybegin(PASS3);
-    return Token.NULL;
+    return Token.PASS_END;
             }  // fall though
             case 1496: break;
             case PASS3: {
-              System.out.println("Starting Pass 4");
+              if (verbose) System.out.println("Starting Pass 4");
     resetFileReading();
     yybegin(PASS4);
-    return Token.NULL;
+    return Token.PASS_END;
             }  // fall though
             case 1497: break;
             case PASS4: {
-              System.out.println("Starting Pass 5");
+              if (verbose) System.out.println("Starting Pass 5");
     resetFileReading();
     yybegin(PASS5);
-    return Token.NULL;
+    return Token.PASS_END;
             }  // fall though
             case 1498: break;
             case PASS5: {
-              System.out.println("Starting Pass 6");
+              if (verbose) System.out.println("Starting Pass 6");
     resetFileReading();
     yybegin(PASS6);
-    return Token.NULL;
+    return Token.PASS_END;
             }  // fall though
             case 1499: break;
             case PASS6: {
@@ -2478,8 +984,8 @@ public class Scanner {
       else {
         switch (zzAction < 0 ? zzAction : ZZ_ACTION[zzAction]) {
           case 1:
-            { System.out.println("Starting Pass 1");
-    yypushback(1);
+            { if (verbose) System.out.println("Starting Pass 1");
+    pushback(1);
     yybegin(PASS1);
             }
           // fall through
@@ -2499,6 +1005,10 @@ public class Scanner {
     //System.out.println(yytext());
     if (!stack.empty())
     {
+        if (stack.peek() == 3 || stack.peek() == 4)
+        {
+            functionEnded(yyline + 1);
+        }
         if (stack.peek() == 3 || (stack.peek() == 4 && !isJava))
         {
             stack.pop();
@@ -2561,6 +1071,8 @@ public class Scanner {
     {
         lastLineComplete = false;
     }
+
+    codeLine(trueString.trim(), yyline + 1);
     
     if (indent.indexOf("\t") != -1)
     {
@@ -2597,7 +1109,7 @@ public class Scanner {
     //System.out.println("length: " + text.length());
     if (text.length() > 132)
     {
-        return new Token("Line exceeds 132 lines", yyline + 2, true);
+        return new Token("Line exceeds 132 lines", yyline + 1, true);
     }
             }
           // fall through
@@ -2699,6 +1211,8 @@ public class Scanner {
     {
         lastLineComplete = false;
     }
+
+    codeLine(trueString.trim(), yyline + 1);
     
     if (indent.indexOf("\t") != -1)
     {
@@ -2734,7 +1248,7 @@ public class Scanner {
             { String text = yytext();
     if (!text.matches(".*[^ \t\f](.*)//.*"))
     {
-        return new Token("Single line comment on its own line; should be converted to a block comment", yyline + 2, true);
+        return new Token("Single line comment on its own line; should be converted to a block comment", yyline + 1, true);
     }
             }
           // fall through
@@ -2747,7 +1261,7 @@ public class Scanner {
     //System.out.println("length: " + text.length());
     if (text.length() > 132)
     {
-        return new Token("Line exceeds 132 lines", yyline + 2, true);
+        return new Token("Line exceeds 132 lines", yyline + 1, true);
     }
             }
           // fall through
@@ -2770,7 +1284,7 @@ public class Scanner {
     String lastLine = lines[lines.length - 1];
     lastLine = lastLine.split("//", 2)[0];
     //System.out.println("lastLine = " + lastLine);
-    yypushback(Math.min(lastLine.length() + 1, yylength() - 1));
+    pushback(Math.min(lastLine.length() + 1, yylength() - 1));
     if (!lastLine.matches("([} \\t\\f\\r\\n]*)|([ \t\f]*(else|catch)([ \t\f].*)?)"))
     {
         return new Token("Missing whitespace after brace", yyline + 1,
@@ -2801,12 +1315,14 @@ public class Scanner {
             { //System.out.println("other statement met");
     //System.out.println(yytext());
     stack.push(0);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
           case 58: break;
           case 17:
-            { return new Token("Block comment does not have asterisks on each"
+            { codeBeforeComment(yytext(), yyline + 1);
+    return new Token("Block comment does not have asterisks on each"
         + " line", yyline + 1, true);
             }
           // fall through
@@ -2818,7 +1334,7 @@ public class Scanner {
             { String text = yytext();
     if (!text.matches(".*[^ \t\f](.*)//.*"))
     {
-        return new Token("Single line comment on its own line; should be converted to a block comment", yyline + 2, true);
+        return new Token("Single line comment on its own line; should be converted to a block comment", yyline + 1, true);
     }
             }
           // fall through
@@ -2827,7 +1343,12 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -1);
-            { String text = yytext();
+            { ruleStarted();
+    if (constants.isDefinition(yyline + 1))
+    {
+        return ruleFinished("magic number", Token.NULL);
+    }
+    String text = yytext();
     //System.out.println(text);
     Matcher matcher = Pattern.compile(
         "[=\\-/+\\[\\]\\(\\)*&^%!~?:; \\t\\f][0-9]+(\\.[0-9]+)?[=\\-/+"
@@ -2841,12 +1362,17 @@ public class Scanner {
         String match = text.substring(startIndex, endIndex);
         //System.out.printf("[[\"%s\"-\"%s\"]]\n", before, match);
         if (!match.matches("0|1|0.0|1.0") && 
-            !before.matches("^((#define |final )|(.*( final ))).*$"))
+            !before.matches("^((#define |final )|(.*( final ))).*$") &&
+            !ConstantTable.isDimension(before))
         {
-            return new Token("Potential magic number", yyline + 1,
-                false);
+            String constant = constants.nameFor(match);
+            return ruleFinished("magic number",
+                new Token("Potential magic number" + (constant == null
+                    ? "" : "; use the constant " + constant), yyline + 1,
+                    false));
         }
     }
+    ruleFinished("magic number", Token.NULL);
             }
           // fall through
           case 61: break;
@@ -2861,7 +1387,7 @@ public class Scanner {
           case 21:
             { String length = yytext();
     String[] lines = length.split("\\r\\n|\\n");
-    yypushback(Math.min(lines[lines.length-1].length() + 2, yylength() - 1));
+    pushback(Math.min(lines[lines.length-1].length() + 2, yylength() - 1));
             }
           // fall through
           case 63: break;
@@ -2875,7 +1401,7 @@ public class Scanner {
     String lastLine = lines[lines.length - 1];
     lastLine = lastLine.split("//", 2)[0];
     //System.out.println("lastLine = " + lastLine);
-    yypushback(Math.min(lastLine.length() + 1, yylength() - 1));
+    pushback(Math.min(lastLine.length() + 1, yylength() - 1));
     if (!lastLine.matches("([} \\t\\f\\r\\n]*)|([ \t\f]*(else|catch)([ \t\f].*)?)"))
     {
         return new Token("Missing whitespace after brace", yyline + 1,
@@ -2885,7 +1411,8 @@ public class Scanner {
           // fall through
           case 64: break;
           case 23:
-            { String text = yytext();
+            { ruleStarted();
+    String text = yytext();
     //System.out.println(text);
     String[] parts = text.split("[ \\t\\f\\(=;]+");
     //System.out.println(Arrays.toString(parts));
@@ -2907,35 +1434,41 @@ public class Scanner {
 
     if (variableName.equals("l") || variableName.equals("O"))
     {
-        return new Token("Variable name " + variableName 
-            + " is always invalid ", yyline + 1, true);
+        return ruleFinished("variable definition",
+            new Token("Variable name " + variableName 
+                + " is always invalid ", yyline + 1, true));
     }
     else if ((variableName.equals("i") || variableName.equals("j") || variableName.equals("k")) && !withinFor)
     {
-        return new Token("Variable " + variableName 
-            + " has potentially an invalid name because it is not a"
-            + " loop constant unless it maps to a design document or"
-            + " has a physical significance", yyline + 1, false);
+        return ruleFinished("variable definition",
+            new Token("Variable " + variableName 
+                + " has potentially an invalid name because it is not a"
+                + " loop constant unless it maps to a design document or"
+                + " has a physical significance", yyline + 1, false));
     }
     else if (variableName.length() == 1 && 
         Character.isUpperCase(variableName.charAt(0)))
     {
-        return new Token("Variable " + variableName + " has an invalid"
-            + " name unless it maps to a design document or has a"
-            + " physical significance", yyline + 1, true);
+        return ruleFinished("variable definition",
+            new Token("Variable " + variableName + " has an invalid"
+                + " name unless it maps to a design document or has a"
+                + " physical significance", yyline + 1, true));
     }
     else if ((!variableName.matches("[a-z0-9]+([A-Z_][a-z0-9]*)*") &&
              !variableName.matches("[A-Z0-9_]*")) && !constant)
     {
-        return new Token("Variable name " + variableName + " should be"
-            + " lower camel case or upper snake case", yyline + 1, 
-            true);
+        return ruleFinished("variable definition",
+            new Token("Variable name " + variableName + " should be"
+                + " lower camel case or upper snake case", yyline + 1, 
+                true));
     }
     else if (constant && !variableName.matches("[A-Z0-9_]*"))
     {
-        return new Token("Constant variable " + variableName + " should"
-            + " be in upper snake case", yyline + 1, true);
+        return ruleFinished("variable definition",
+            new Token("Constant variable " + variableName + " should"
+                + " be in upper snake case", yyline + 1, true));
     }
+    ruleFinished("variable definition", Token.NULL);
             }
           // fall through
           case 65: break;
@@ -2946,12 +1479,14 @@ public class Scanner {
             { //System.out.println("other statement met");
     //System.out.println(yytext());
     stack.push(0);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
           case 66: break;
           case 25:
             { String text = yytext();
+    codeBeforeComment(text, yyline + 1);
     String[] lines = text.split("\n");
     boolean isNotIndented = true;
     boolean isIndentedOnce = true;
@@ -2987,7 +1522,12 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -2);
-            { String text = yytext();
+            { ruleStarted();
+    if (constants.isDefinition(yyline + 1))
+    {
+        return ruleFinished("magic number", Token.NULL);
+    }
+    String text = yytext();
     //System.out.println(text);
     Matcher matcher = Pattern.compile(
         "[=\\-/+\\[\\]\\(\\)*&^%!~?:; \\t\\f][0-9]+(\\.[0-9]+)?[=\\-/+"
@@ -3001,18 +1541,27 @@ public class Scanner {
         String match = text.substring(startIndex, endIndex);
         //System.out.printf("[[\"%s\"-\"%s\"]]\n", before, match);
         if (!match.matches("0|1|0.0|1.0") && 
-            !before.matches("^((#define |final )|(.*( final ))).*$"))
+            !before.matches("^((#define |final )|(.*( final ))).*$") &&
+            !ConstantTable.isDimension(before))
         {
-            return new Token("Potential magic number", yyline + 1,
-                false);
+            String constant = constants.nameFor(match);
+            return ruleFinished("magic number",
+                new Token("Potential magic number" + (constant == null
+                    ? "" : "; use the constant " + constant), yyline + 1,
+                    false));
         }
     }
+    ruleFinished("magic number", Token.NULL);
             }
           // fall through
           case 68: break;
           case 27:
             { //System.out.println("break met");
     //System.out.println(stack);
+    if (function != null)
+    {
+        function.breaks++;
+    }
     if (!stack.empty() && stack.lastIndexOf(2) > stack.lastIndexOf(1))
     {
         return new Token("Break statement in loop", yyline + 1, true);
@@ -3062,6 +1611,7 @@ public class Scanner {
             { //System.out.println("for/while loop met");
     //System.out.println(yytext());
     stack.push(2);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
@@ -3073,6 +1623,7 @@ public class Scanner {
             { //System.out.println("for/while loop met");
     //System.out.println(yytext());
     stack.push(2);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
@@ -3081,7 +1632,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -1);
-            { String token = "[A-Za-z0-9_]+";
+            { ruleStarted();
+    String token = "[A-Za-z0-9_]+";
     String operator = "(>|<|>=|<=|==)";
     String text = yytext();
     text = text.substring(text.indexOf('f'));
@@ -3101,8 +1653,9 @@ public class Scanner {
                 token, token, token))
            )
         {
-            return new Token("For loop white space is incorrect", 
-                yyline + 1, true);
+            return ruleFinished("for loop",
+                new Token("For loop white space is incorrect", 
+                    yyline + 1, true));
         }
     }
     else // worst case scenario - for loop is not typical; does its 
@@ -3110,10 +1663,12 @@ public class Scanner {
     {
         if (!text.matches("for \\(.*;( .*)?;( .*)?\\)"))
         {
-            return new Token("For loop white space is incorrect", 
-                yyline + 1, true);
+            return ruleFinished("for loop",
+                new Token("For loop white space is incorrect", 
+                    yyline + 1, true));
         }
     }
+    ruleFinished("for loop", Token.NULL);
             }
           // fall through
           case 73: break;
@@ -3121,7 +1676,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -2);
-            { String token = "[A-Za-z0-9_]+";
+            { ruleStarted();
+    String token = "[A-Za-z0-9_]+";
     String operator = "(>|<|>=|<=|==)";
     String text = yytext();
     text = text.substring(text.indexOf('f'));
@@ -3141,8 +1697,9 @@ public class Scanner {
                 token, token, token))
            )
         {
-            return new Token("For loop white space is incorrect", 
-                yyline + 1, true);
+            return ruleFinished("for loop",
+                new Token("For loop white space is incorrect", 
+                    yyline + 1, true));
         }
     }
     else // worst case scenario - for loop is not typical; does its 
@@ -3150,10 +1707,12 @@ public class Scanner {
     {
         if (!text.matches("for \\(.*;( .*)?;( .*)?\\)"))
         {
-            return new Token("For loop white space is incorrect", 
-                yyline + 1, true);
+            return ruleFinished("for loop",
+                new Token("For loop white space is incorrect", 
+                    yyline + 1, true));
         }
     }
+    ruleFinished("for loop", Token.NULL);
             }
           // fall through
           case 74: break;
@@ -3161,7 +1720,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -1);
-            { //System.out.println("function/method met");
+            { ruleStarted();
+    //System.out.println("function/method met");
     String text = yytext();
     String[] lines = text.split("\\r\\n|\\n", 2);
     text = lines[1].substring(0, lines[1].indexOf('('));
@@ -3171,8 +1731,8 @@ public class Scanner {
     {
         if (s.matches("if|else|class|interface"))
         {
-            yypushback(Math.min(yylength() - lines[0].length(), yylength() - 1));
-            return Token.NULL;
+            pushback(Math.min(yylength() - lines[0].length(), yylength() - 1));
+            return ruleFinished("function header", Token.NULL);
         }
     }
     //System.out.println(lines[0]);
@@ -3180,23 +1740,31 @@ public class Scanner {
     boolean isVoid = keywords[keywords.length - 2].equals("void");
 
     stack.push(isVoid ? 4 : 3);
+    functionStarted(keywords[keywords.length - 1], yyline + 2);
     //System.out.println(stack);
     if (!lines[0].matches(".*\\*\\/[ \t\f]*"))
     {
-        return new Token("Function/method must be immediately preceded"
-            + " by a block comment", yyline + 1, true);
+        return ruleFinished("function header",
+            new Token("Function/method must be immediately preceded"
+                + " by a block comment", yyline + 1, true));
     }
     if (!text.matches("^.*[^ \t\f]$"))
     {
-        return new Token("There should be no space between method/"
-            + " function name and parentheses", yyline + 1, true);
+        return ruleFinished("function header",
+            new Token("There should be no space between method/"
+                + " function name and parentheses", yyline + 1, true));
     }
+    ruleFinished("function header", Token.NULL);
             }
           // fall through
           case 75: break;
           case 34:
             { //System.out.println("default return statement met");
     //System.out.println(stack);
+    if (function != null)
+    {
+        function.returns++;
+    }
     return new Token("Return statement is not the last executable line"
         + " of the method/function. This is only allowed for \"very"
         + " small functions\"",
@@ -3206,17 +1774,22 @@ public class Scanner {
           case 76: break;
           case 35:
             { //System.out.println("final return statement");
+    if (function != null)
+    {
+        function.returns++;
+    }
     if (!stack.empty())
     {
         if (stack.peek() == 3 || stack.peek() == 4)
         {
+            functionEnded(yyline + yytext().split("\n", -1).length);
             stack.pop();
             //System.out.println(stack);
         }
         else
         {
             //System.out.println(stack);
-            yypushback(yylength() - yytext().indexOf('r') - 1);
+            pushback(yylength() - yytext().indexOf('r') - 1);
             return new Token("Return statement is not the last"
                 + " executable line of the method/function. This is"
                 + " only allowed for \"very small functions\"",
@@ -3233,6 +1806,7 @@ public class Scanner {
             { //System.out.println("switch statement met");
     //System.out.println(yytext());
     stack.push(1);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
@@ -3247,7 +1821,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -2);
-            { //System.out.println("function/method met");
+            { ruleStarted();
+    //System.out.println("function/method met");
     String text = yytext();
     String[] lines = text.split("\\r\\n|\\n", 2);
     text = lines[1].substring(0, lines[1].indexOf('('));
@@ -3257,8 +1832,8 @@ public class Scanner {
     {
         if (s.matches("if|else|class|interface"))
         {
-            yypushback(Math.min(yylength() - lines[0].length(), yylength() - 1));
-            return Token.NULL;
+            pushback(Math.min(yylength() - lines[0].length(), yylength() - 1));
+            return ruleFinished("function header", Token.NULL);
         }
     }
     //System.out.println(lines[0]);
@@ -3266,17 +1841,21 @@ public class Scanner {
     boolean isVoid = keywords[keywords.length - 2].equals("void");
 
     stack.push(isVoid ? 4 : 3);
+    functionStarted(keywords[keywords.length - 1], yyline + 2);
     //System.out.println(stack);
     if (!lines[0].matches(".*\\*\\/[ \t\f]*"))
     {
-        return new Token("Function/method must be immediately preceded"
-            + " by a block comment", yyline + 1, true);
+        return ruleFinished("function header",
+            new Token("Function/method must be immediately preceded"
+                + " by a block comment", yyline + 1, true));
     }
     if (!text.matches("^.*[^ \t\f]$"))
     {
-        return new Token("There should be no space between method/"
-            + " function name and parentheses", yyline + 1, true);
+        return ruleFinished("function header",
+            new Token("There should be no space between method/"
+                + " function name and parentheses", yyline + 1, true));
     }
+    ruleFinished("function header", Token.NULL);
             }
           // fall through
           case 80: break;
@@ -3287,6 +1866,7 @@ public class Scanner {
             { //System.out.println("switch statement met");
     //System.out.println(yytext());
     stack.push(1);
+    blockOpened(yytext());
     //System.out.println(stack);
             }
           // fall through
@@ -3316,7 +1896,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -1);
-            { String text = yytext();
+            { ruleStarted();
+    String text = yytext();
     text = text.substring(text.indexOf('\n') + 1);
     //System.out.println("STRING:\n" + text + "\nEND");
     String[] lines = text.split("\n|\r\n");
@@ -3325,9 +1906,10 @@ public class Scanner {
     if (!lines[1].matches("^[ \t\f]*\\{[ \t\f]*$"))
     { 
         // returns everything but the opening brace
-        yypushback(yylength() - 1);
-        return new Token("Opening brace must be on its own line", 
-            yyline + 3, true);
+        pushback(yylength() - 1);
+        return ruleFinished("long block",
+            new Token("Opening brace must be on its own line", 
+                yyline + 3, true));
     }
     String lastLine = lines[lines.length - 1];
     //System.out.printf("lastLine: %s\n", lastLine);
@@ -3339,12 +1921,14 @@ public class Scanner {
         !lastLine.matches("} // " + Pattern.quote(firstLine) + 
             "[ \t\f]*$"))
     {
-        yypushback(yylength() - 1);
-        return new Token("A Block of more than 10 lines has no comment"
-            + " or it is improperly placed or formatted", yyline + 2,
-            true);
+        pushback(yylength() - 1);
+        return ruleFinished("long block",
+            new Token("A Block of more than 10 lines has no comment"
+                + " or it is improperly placed or formatted", yyline + 2,
+                true));
     }
     //System.out.println(Arrays.toString(lines));
+    ruleFinished("long block", Token.NULL);
             }
           // fall through
           case 83: break;
@@ -3352,7 +1936,8 @@ public class Scanner {
             // lookahead expression with fixed lookahead length
             zzMarkedPos = Character.offsetByCodePoints
                 (zzBufferL, zzStartRead, zzEndRead - zzStartRead, zzMarkedPos, -2);
-            { String text = yytext();
+            { ruleStarted();
+    String text = yytext();
     text = text.substring(text.indexOf('\n') + 1);
     //System.out.println("STRING:\n" + text + "\nEND");
     String[] lines = text.split("\n|\r\n");
@@ -3361,9 +1946,10 @@ public class Scanner {
     if (!lines[1].matches("^[ \t\f]*\\{[ \t\f]*$"))
     { 
         // returns everything but the opening brace
-        yypushback(yylength() - 1);
-        return new Token("Opening brace must be on its own line", 
-            yyline + 3, true);
+        pushback(yylength() - 1);
+        return ruleFinished("long block",
+            new Token("Opening brace must be on its own line", 
+                yyline + 3, true));
     }
     String lastLine = lines[lines.length - 1];
     //System.out.printf("lastLine: %s\n", lastLine);
@@ -3375,12 +1961,14 @@ public class Scanner {
         !lastLine.matches("} // " + Pattern.quote(firstLine) + 
             "[ \t\f]*$"))
     {
-        yypushback(yylength() - 1);
-        return new Token("A Block of more than 10 lines has no comment"
-            + " or it is improperly placed or formatted", yyline + 2,
-            true);
+        pushback(yylength() - 1);
+        return ruleFinished("long block",
+            new Token("A Block of more than 10 lines has no comment"
+                + " or it is improperly placed or formatted", yyline + 2,
+                true));
     }
     //System.out.println(Arrays.toString(lines));
+    ruleFinished("long block", Token.NULL);
             }
           // fall through
           case 84: break;
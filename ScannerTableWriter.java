@@ -0,0 +1,182 @@
+
+import java.io.BufferedOutputStream;
+import java.io.DataOutputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.lang.reflect.Field;
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Writes Scanner.tables, the resource ScannerTables loads, from the
+ * tables that JFlex generates into Scanner.java. This is the build step
+ * after every regeneration of the Scanner:
+ *
+ *   jflex main.flex
+ *   javac Scanner.java ScannerTableWriter.java
+ *   java ScannerTableWriter
+ *
+ * after which the six table fields of the generated Scanner.java are
+ * pointed at ScannerTables again, its packed strings and zzUnpack
+ * methods removed, and a call to ScannerTables.load added to yybegin,
+ * as in the checked-in Scanner.java. (JFlex writes the tables outside of
+ * its skeleton, so this cannot be done with a skeleton file.)
+ *
+ * The tables are read from the generated Scanner's own fields, once its
+ * static initializer has unpacked them, so the writer does not depend on
+ * how JFlex packs them. The section of each lexical state holds the DFA
+ * states reachable from its two start states (at the beginning of a line
+ * and elsewhere).
+ *
+ * Usage: java ScannerTableWriter [FILE]
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ScannerTableWriter
+{
+    /**
+     * Writes the resource.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args)
+        throws IOException, ReflectiveOperationException
+    {
+        String fileName = args.length > 0 ? args[0] : ScannerTables.RESOURCE;
+        try
+        {
+            Scanner.class.getDeclaredField("ZZ_TRANS_PACKED_0");
+        }
+        catch (NoSuchFieldException e)
+        {
+            System.out.println("Scanner.java already loads "
+                + ScannerTables.RESOURCE + "; regenerate it with JFlex first");
+            System.exit(2);
+        }
+        int[] lexicalStates = table("ZZ_LEXSTATE");
+        int[] cmapTop = table("ZZ_CMAP_TOP");
+        int[] cmapBlocks = table("ZZ_CMAP_BLOCKS");
+        int[] action = table("ZZ_ACTION");
+        int[] rowMap = table("ZZ_ROWMAP");
+        int[] trans = table("ZZ_TRANS");
+        int[] attribute = table("ZZ_ATTRIBUTE");
+        int columns = 0;
+        for (int c : cmapBlocks)
+        {
+            columns = Math.max(columns, c + 1);
+        }
+
+        List<int[]> sections = new ArrayList<>();
+        for (int l = 0; l < lexicalStates.length / 2; l++)
+        {
+            sections.add(reachable(lexicalStates[2 * l],
+                lexicalStates[2 * l + 1], rowMap, trans, columns));
+        }
+
+        try (DataOutputStream out = new DataOutputStream(
+            new BufferedOutputStream(new FileOutputStream(fileName))))
+        {
+            out.writeInt(ScannerTables.MAGIC);
+            out.writeInt(ScannerTables.VERSION);
+            out.writeInt(columns);
+            out.writeInt(cmapTop.length);
+            out.writeInt(cmapBlocks.length);
+            out.writeInt(rowMap.length);
+            out.writeInt(trans.length);
+            out.writeInt(sections.size());
+            write(out, cmapTop, 0, cmapTop.length);
+            write(out, cmapBlocks, 0, cmapBlocks.length);
+            int position = ScannerTables.HEADER_INTS + cmapTop.length
+                + cmapBlocks.length + sections.size();
+            for (int[] states : sections)
+            {
+                out.writeInt(position);
+                position += 1 + states.length * (4 + columns);
+            }
+            for (int[] states : sections)
+            {
+                out.writeInt(states.length);
+                write(out, states, 0, states.length);
+                for (int state : states)
+                {
+                    out.writeInt(rowMap[state]);
+                }
+                for (int state : states)
+                {
+                    out.writeInt(action[state]);
+                }
+                for (int state : states)
+                {
+                    out.writeInt(attribute[state]);
+                }
+                for (int state : states)
+                {
+                    write(out, trans, rowMap[state], columns);
+                }
+            }
+            System.out.printf("Wrote %s: %d lexical states, %d bytes\n",
+                fileName, sections.size(), out.size());
+        }
+    }
+
+    private static int[] table(String name) throws ReflectiveOperationException
+    {
+        Field field = Scanner.class.getDeclaredField(name);
+        field.setAccessible(true);
+        return (int[]) field.get(null);
+    }
+
+    /**
+     * @return the DFA states that can be reached from either start state,
+     *         in increasing order
+     */
+    private static int[] reachable(int first, int second, int[] rowMap,
+        int[] trans, int columns)
+    {
+        boolean[] seen = new boolean[rowMap.length];
+        ArrayDeque<Integer> queue = new ArrayDeque<>();
+        seen[first] = true;
+        queue.add(first);
+        if (!seen[second])
+        {
+            seen[second] = true;
+            queue.add(second);
+        }
+        int count = 0;
+        while (!queue.isEmpty())
+        {
+            int state = queue.poll();
+            count++;
+            for (int c = 0; c < columns; c++)
+            {
+                int next = trans[rowMap[state] + c];
+                if (next >= 0 && !seen[next])
+                {
+                    seen[next] = true;
+                    queue.add(next);
+                }
+            }
+        }
+        int[] states = new int[count];
+        int i = 0;
+        for (int state = 0; state < seen.length; state++)
+        {
+            if (seen[state])
+            {
+                states[i++] = state;
+            }
+        }
+        return states;
+    }
+
+    private static void write(DataOutputStream out, int[] values, int from,
+        int length) throws IOException
+    {
+        for (int i = from; i < from + length; i++)
+        {
+            out.writeInt(values[i]);
+        }
+    }
+}
@@ -0,0 +1,166 @@
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.net.URISyntaxException;
+import java.net.URL;
+import java.nio.ByteBuffer;
+import java.nio.IntBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+
+/**
+ * The DFA tables of the Scanner, read from the precomputed binary
+ * resource Scanner.tables instead of being unpacked from the string
+ * constants that JFlex writes into Scanner.java.
+ *
+ * When the Scanner class is initialized the resource is memory-mapped
+ * (or read in one bulk read if it is not a plain file, e.g. in a jar),
+ * and only the character maps and the states of YYINITIAL are copied
+ * out of it. The transitions, actions and attributes of the DFA states
+ * of every other lexical state are copied in by load when the Scanner
+ * first enters that state, so a run pays only for the passes it reaches.
+ *
+ * The format, big-endian ints:
+ *
+ *   MAGIC, VERSION
+ *   number of character classes C (the length of a row of transitions)
+ *   lengths of the top and second-level character maps, number of DFA
+ *   states, length of the transition table, number of lexical states L
+ *   the two character maps
+ *   offset (in ints) of the section of each lexical state (L)
+ *   section of each lexical state:
+ *     number N of the DFA states reachable from its start states
+ *     those states (N), their rows in the transition table (N), their
+ *     actions (N) and attributes (N)
+ *     their rows of transitions (N * C)
+ *
+ * ScannerTableWriter writes the resource from a freshly generated
+ * Scanner.java.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ScannerTables
+{
+    static final int MAGIC = 0x4e444641; // "NDFA"
+    static final int VERSION = 1;
+    static final String RESOURCE = "Scanner.tables";
+    static final int HEADER_INTS = 8;
+
+    static final int[] CMAP_TOP;
+    static final int[] CMAP_BLOCKS;
+    static final int[] ACTION;
+    static final int[] ROWMAP;
+    static final int[] TRANS;
+    static final int[] ATTRIBUTE;
+
+    private static final IntBuffer DATA;
+    private static final int COLUMNS;
+    private static final int[] SECTIONS; // by lexical state / 2
+    private static volatile int loaded = 0; // bit l: lexical state 2 * l
+
+    static
+    {
+        try
+        {
+            DATA = read().asIntBuffer();
+        }
+        catch (IOException e)
+        {
+            throw new IllegalStateException("Cannot read " + RESOURCE, e);
+        }
+        if (DATA.limit() < HEADER_INTS || DATA.get(0) != MAGIC
+            || DATA.get(1) != VERSION)
+        {
+            throw new IllegalStateException(RESOURCE
+                + " is not a table file for this Scanner");
+        }
+        COLUMNS = DATA.get(2);
+        CMAP_TOP = new int[DATA.get(3)];
+        CMAP_BLOCKS = new int[DATA.get(4)];
+        ACTION = new int[DATA.get(5)];
+        ROWMAP = new int[DATA.get(5)];
+        ATTRIBUTE = new int[DATA.get(5)];
+        TRANS = new int[DATA.get(6)];
+        SECTIONS = new int[DATA.get(7)];
+        int position = HEADER_INTS;
+        DATA.get(position, CMAP_TOP);
+        position += CMAP_TOP.length;
+        DATA.get(position, CMAP_BLOCKS);
+        position += CMAP_BLOCKS.length;
+        DATA.get(position, SECTIONS);
+        load(Scanner.YYINITIAL);
+    }
+
+    /**
+     * Makes sure the tables of a lexical state are in place. Called by
+     * Scanner.yybegin before the Scanner enters the state; safe to call
+     * from many threads at once.
+     *
+     * @param lexicalState e.g. Scanner.PASS1
+     */
+    static void load(int lexicalState)
+    {
+        int bit = 1 << (lexicalState / 2);
+        if ((loaded & bit) != 0)
+        {
+            return;
+        }
+        synchronized (ScannerTables.class)
+        {
+            if ((loaded & bit) == 0)
+            {
+                copy(SECTIONS[lexicalState / 2]);
+                loaded |= bit;
+            }
+        }
+    }
+
+    /**
+     * Copies one section into the tables. States that two lexical states
+     * share are copied twice, with the same values.
+     */
+    private static void copy(int position)
+    {
+        int n = DATA.get(position++);
+        int rows = position + 4 * n;
+        for (int i = 0; i < n; i++)
+        {
+            int state = DATA.get(position + i);
+            ROWMAP[state] = DATA.get(position + n + i);
+            ACTION[state] = DATA.get(position + 2 * n + i);
+            ATTRIBUTE[state] = DATA.get(position + 3 * n + i);
+            DATA.get(rows + i * COLUMNS, TRANS, ROWMAP[state], COLUMNS);
+        }
+    }
+
+    /**
+     * @return the whole resource, mapped if it is a plain file
+     */
+    private static ByteBuffer read() throws IOException
+    {
+        URL url = ScannerTables.class.getResource(RESOURCE);
+        if (url == null)
+        {
+            throw new IOException(RESOURCE + " is not on the class path");
+        }
+        if (url.getProtocol().equals("file"))
+        {
+            try (FileChannel channel = FileChannel.open(Path.of(url.toURI()),
+                StandardOpenOption.READ))
+            {
+                return channel.map(FileChannel.MapMode.READ_ONLY, 0,
+                    channel.size());
+            }
+            catch (URISyntaxException e)
+            {
+                // read it as a stream instead
+            }
+        }
+        try (InputStream in = url.openStream())
+        {
+            return ByteBuffer.wrap(in.readAllBytes());
+        }
+    }
+}
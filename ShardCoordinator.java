@@ -0,0 +1,351 @@
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Paths;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.BlockingDeque;
+import java.util.concurrent.Executors;
+import java.util.concurrent.LinkedBlockingDeque;
+import java.util.concurrent.ScheduledExecutorService;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicIntegerArray;
+
+/**
+ * Splits a batch run across several local worker JVMs (ShardWorker) so
+ * that each one keeps a small heap.
+ *
+ * Files are grouped into shards of roughly equal byte count, largest
+ * files first, and every worker pulls the next shard as soon as it is
+ * idle. A worker that crashes, or makes no progress for longer than the
+ * timeout, is killed and restarted, and the unfinished part of its shard
+ * is handed out again. A file that takes down its worker MAX_ATTEMPTS
+ * times is reported as failed instead of being retried forever.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ShardCoordinator
+{
+    private static final int MAX_ATTEMPTS = 2;
+    private static final int SHARDS_PER_PROCESS = 16;
+    private static final int MAX_SHARD_FILES = 64;
+    private static final long MIN_SHARD_BYTES = 64 * 1024;
+
+    private final List<File> files;
+    private final List<String> paths;
+    private final int processes;
+    private final String workerHeap;
+    private final long timeoutNanos;
+    private final ResultSink report;
+    private final boolean triage;
+
+    private final BlockingDeque<List<Integer>> shards =
+        new LinkedBlockingDeque<>();
+    private final AtomicInteger remaining;
+    private final AtomicIntegerArray attempts;
+
+    /**
+     * @param files the files of the batch, in report order
+     * @param processes number of worker JVMs
+     * @param workerHeap maximum heap of each worker (as for -Xmx), or
+     *                   null for the JVM default
+     * @param timeoutMillis how long a worker may spend on one file
+     * @param report receives the result of every file
+     * @param triage whether workers run Triage on each file first
+     */
+    public ShardCoordinator (List<File> files, int processes,
+        String workerHeap, long timeoutMillis, ResultSink report,
+        boolean triage)
+    {
+        this.files = files;
+        this.paths = new ArrayList<>(files.size());
+        for (File file : files)
+        {
+            paths.add(file.getPath());
+        }
+        this.processes = processes;
+        this.workerHeap = workerHeap;
+        this.timeoutNanos = TimeUnit.MILLISECONDS.toNanos(timeoutMillis);
+        this.report = report;
+        this.triage = triage;
+        this.remaining = new AtomicInteger(files.size());
+        this.attempts = new AtomicIntegerArray(files.size());
+    }
+
+    /**
+     * Analyzes every file and returns once all results have reached the
+     * report.
+     */
+    public void run() throws InterruptedException
+    {
+        planShards();
+
+        Slot[] slots = new Slot[processes];
+        Thread[] threads = new Thread[processes];
+        for (int i = 0; i < processes; i++)
+        {
+            slots[i] = new Slot();
+            threads[i] = new Thread(slots[i]::run, "shard-slot-" + i);
+            threads[i].start();
+        }
+
+        ScheduledExecutorService watchdog =
+            Executors.newSingleThreadScheduledExecutor(r -> {
+                Thread t = new Thread(r, "shard-watchdog");
+                t.setDaemon(true);
+                return t;
+            });
+        long period = Math.max(timeoutNanos / 4,
+            TimeUnit.MILLISECONDS.toNanos(50));
+        watchdog.scheduleAtFixedRate(() -> {
+            long now = System.nanoTime();
+            for (Slot slot : slots)
+            {
+                slot.checkTimeout(now);
+            }
+        }, period, period, TimeUnit.NANOSECONDS);
+
+        try
+        {
+            for (Thread t : threads)
+            {
+                t.join();
+            }
+        }
+        finally
+        {
+            watchdog.shutdownNow();
+        }
+    }
+
+    /**
+     * Groups the files into shards of about the same number of bytes,
+     * largest files first, so that the long files start early and the
+     * small ones fill in the gaps at the end of the run.
+     */
+    private void planShards()
+    {
+        int n = files.size();
+        Integer[] order = new Integer[n];
+        long[] sizes = new long[n];
+        long total = 0;
+        for (int i = 0; i < n; i++)
+        {
+            order[i] = i;
+            sizes[i] = files.get(i).length();
+            total += sizes[i];
+        }
+        Arrays.sort(order, (a, b)->Long.compare(sizes[b], sizes[a]));
+
+        long target = Math.max(MIN_SHARD_BYTES,
+            total / ((long) processes * SHARDS_PER_PROCESS));
+        List<Integer> shard = new ArrayList<>();
+        long bytes = 0;
+        for (int index : order)
+        {
+            shard.add(index);
+            bytes += sizes[index];
+            if (bytes >= target || shard.size() >= MAX_SHARD_FILES)
+            {
+                shards.add(shard);
+                shard = new ArrayList<>();
+                bytes = 0;
+            }
+        }
+        if (!shard.isEmpty())
+        {
+            shards.add(shard);
+        }
+    }
+
+    private void complete(FileResult result)
+    {
+        report.accept(result);
+        remaining.decrementAndGet();
+    }
+
+    private List<String> workerCommand()
+    {
+        List<String> command = new ArrayList<>();
+        command.add(Paths.get(System.getProperty("java.home"), "bin", "java")
+            .toString());
+        if (workerHeap != null)
+        {
+            command.add("-Xmx" + workerHeap);
+        }
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add("ShardWorker");
+        if (!triage)
+        {
+            command.add("--no-triage");
+        }
+        return command;
+    }
+
+    /**
+     * One worker process and the coordinator thread that feeds it.
+     */
+    private class Slot
+    {
+        private volatile Process process;
+        private DataOutputStream toWorker;
+        private DataInputStream fromWorker;
+        private volatile long lastProgress;
+        private volatile boolean busy = false;
+        private volatile boolean timedOut = false;
+
+        void run()
+        {
+            try
+            {
+                while (remaining.get() > 0)
+                {
+                    List<Integer> shard =
+                        shards.poll(100, TimeUnit.MILLISECONDS);
+                    if (shard != null)
+                    {
+                        serve(shard);
+                    }
+                }
+            }
+            catch (InterruptedException e)
+            {
+                Thread.currentThread().interrupt();
+            }
+            finally
+            {
+                stop();
+            }
+        }
+
+        private void serve(List<Integer> shard)
+        {
+            int done = 0;
+            try
+            {
+                if (process == null)
+                {
+                    start();
+                }
+                List<String> shardPaths = new ArrayList<>(shard.size());
+                for (int index : shard)
+                {
+                    shardPaths.add(paths.get(index));
+                }
+                lastProgress = System.nanoTime();
+                busy = true;
+                ShardProtocol.writeShard(toWorker, shard, shardPaths);
+                while (true)
+                {
+                    byte tag = fromWorker.readByte();
+                    if (tag == ShardProtocol.DONE)
+                    {
+                        break;
+                    }
+                    FileResult result =
+                        ShardProtocol.readResult(fromWorker, tag, paths);
+                    lastProgress = System.nanoTime();
+                    done++;
+                    complete(result);
+                }
+                busy = false;
+            }
+            catch (IOException e)
+            {
+                busy = false;
+                String reason = timedOut ? "worker timed out"
+                    : "worker crashed (" + e + ")";
+                kill();
+
+                // the worker handles files in order, so the first file
+                // without a result is the one it died on
+                if (done < shard.size())
+                {
+                    int culprit = shard.get(done);
+                    List<Integer> rest =
+                        new ArrayList<>(shard.subList(done, shard.size()));
+                    if (attempts.incrementAndGet(culprit) >= MAX_ATTEMPTS)
+                    {
+                        rest.remove(0);
+                        complete(FileResult.failed(culprit,
+                            paths.get(culprit), reason));
+                    }
+                    if (!rest.isEmpty())
+                    {
+                        shards.addFirst(rest);
+                    }
+                }
+            }
+        }
+
+        private void start() throws IOException
+        {
+            ProcessBuilder builder = new ProcessBuilder(workerCommand());
+            builder.redirectError(ProcessBuilder.Redirect.INHERIT);
+            timedOut = false;
+            process = builder.start();
+            toWorker = new DataOutputStream(
+                new BufferedOutputStream(process.getOutputStream()));
+            fromWorker = new DataInputStream(
+                new BufferedInputStream(process.getInputStream()));
+        }
+
+        private void kill()
+        {
+            Process current = process;
+            if (current != null)
+            {
+                current.destroyForcibly();
+                process = null;
+            }
+        }
+
+        private void stop()
+        {
+            Process current = process;
+            if (current == null)
+            {
+                return;
+            }
+            try
+            {
+                toWorker.writeByte(ShardProtocol.QUIT);
+                toWorker.flush();
+                current.waitFor();
+            }
+            catch (IOException e)
+            {
+                current.destroyForcibly();
+            }
+            catch (InterruptedException e)
+            {
+                current.destroyForcibly();
+                Thread.currentThread().interrupt();
+            }
+            process = null;
+        }
+
+        /**
+         * Kills the worker if it has been stuck on one file for longer
+         * than the timeout. Called from the watchdog thread; the slot's
+         * own thread then sees the broken pipe and recovers.
+         */
+        void checkTimeout(long now)
+        {
+            Process current = process;
+            if (busy && current != null && now - lastProgress > timeoutNanos)
+            {
+                timedOut = true;
+                current.destroyForcibly();
+            }
+        }
+    }
+}
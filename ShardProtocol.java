@@ -0,0 +1,135 @@
+
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * The binary protocol spoken between ShardCoordinator and its
+ * ShardWorker processes over the worker's stdin and stdout.
+ *
+ * Coordinator to worker:
+ *   SHARD  int count, then count times (int index, UTF path)
+ *   QUIT
+ * Worker to coordinator, one frame per file of the shard, in order,
+ * followed by DONE:
+ *   RESULT  int index, boolean triaged, [UTF triage reason if triaged],
+ *           int count, then count times (int line, boolean sure,
+ *           UTF error)
+ *   SKIPPED int index, UTF triage reason
+ *   FAILED  int index, UTF reason
+ *   DONE
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public final class ShardProtocol
+{
+    public static final byte SHARD = 'S';
+    public static final byte QUIT = 'Q';
+    public static final byte RESULT = 'R';
+    public static final byte SKIPPED = 'K';
+    public static final byte FAILED = 'F';
+    public static final byte DONE = 'D';
+
+    private ShardProtocol()
+    {
+    }
+
+    /**
+     * Sends a shard of files to a worker.
+     *
+     * @param out the worker's stdin
+     * @param indices positions of the files in the batch
+     * @param paths paths of the files, parallel to indices
+     */
+    public static void writeShard(DataOutputStream out, List<Integer> indices,
+        List<String> paths) throws IOException
+    {
+        out.writeByte(SHARD);
+        out.writeInt(indices.size());
+        for (int i = 0; i < indices.size(); i++)
+        {
+            out.writeInt(indices.get(i));
+            out.writeUTF(paths.get(i));
+        }
+        out.flush();
+    }
+
+    /**
+     * Sends the result of one file back to the coordinator.
+     *
+     * @param out the worker's stdout
+     * @param result the result of one file of the shard
+     */
+    public static void writeResult(DataOutputStream out, FileResult result)
+        throws IOException
+    {
+        if (result.failure != null)
+        {
+            out.writeByte(FAILED);
+            out.writeInt(result.index);
+            out.writeUTF(result.failure);
+        }
+        else if (result.triage != null && result.triage.skip)
+        {
+            out.writeByte(SKIPPED);
+            out.writeInt(result.index);
+            out.writeUTF(result.triage.reason);
+        }
+        else
+        {
+            out.writeByte(RESULT);
+            out.writeInt(result.index);
+            out.writeBoolean(result.triage != null);
+            if (result.triage != null)
+            {
+                out.writeUTF(result.triage.reason);
+            }
+            out.writeInt(result.tokens.size());
+            for (Scanner.Token t : result.tokens)
+            {
+                out.writeInt(t.line);
+                out.writeBoolean(t.sure);
+                out.writeUTF(t.error);
+            }
+        }
+        out.flush();
+    }
+
+    /**
+     * Reads the body of a RESULT, SKIPPED or FAILED frame whose tag has
+     * already been read.
+     *
+     * @param in the worker's stdout
+     * @param tag RESULT, SKIPPED or FAILED
+     * @param paths paths of every file in the batch, by index
+     * @return the result of one file
+     */
+    public static FileResult readResult(DataInputStream in, byte tag,
+        List<String> paths) throws IOException
+    {
+        int index = in.readInt();
+        if (tag == FAILED)
+        {
+            return FileResult.failed(index, paths.get(index), in.readUTF());
+        }
+        if (tag == SKIPPED)
+        {
+            return FileResult.skipped(index, paths.get(index),
+                new Triage(true, in.readUTF()));
+        }
+        Triage triage = in.readBoolean() ? new Triage(false, in.readUTF())
+            : null;
+        int count = in.readInt();
+        List<Scanner.Token> tokens = new ArrayList<>(count);
+        for (int i = 0; i < count; i++)
+        {
+            int line = in.readInt();
+            boolean sure = in.readBoolean();
+            tokens.add(new Scanner.Token(in.readUTF(), line, sure));
+        }
+        return new FileResult(index, paths.get(index), tokens, null, triage);
+    }
+}
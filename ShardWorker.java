@@ -0,0 +1,65 @@
+
+import java.io.BufferedInputStream;
+import java.io.BufferedOutputStream;
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.EOFException;
+import java.io.File;
+import java.io.FileDescriptor;
+import java.io.FileOutputStream;
+import java.io.IOException;
+
+/**
+ * A worker process started by ShardCoordinator. Reads shards of files
+ * from stdin, analyzes them one at a time and writes each result to
+ * stdout as soon as it is ready (see ShardProtocol).
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class ShardWorker
+{
+    /**
+     * Serves shards until told to quit or stdin is closed.
+     *
+     * @param args "--no-triage" to analyze every file in full
+     */
+    public static void main (String[] args) throws IOException
+    {
+        boolean triage = !(args.length > 0 && args[0].equals("--no-triage"));
+        DataInputStream in = new DataInputStream(
+            new BufferedInputStream(System.in));
+        DataOutputStream out = new DataOutputStream(new BufferedOutputStream(
+            new FileOutputStream(FileDescriptor.out)));
+        // nothing but protocol frames may reach stdout
+        System.setOut(System.err);
+
+        while (true)
+        {
+            byte tag;
+            try
+            {
+                tag = in.readByte();
+            }
+            catch (EOFException e)
+            {
+                break;
+            }
+            if (tag == ShardProtocol.QUIT)
+            {
+                break;
+            }
+
+            int count = in.readInt();
+            for (int i = 0; i < count; i++)
+            {
+                int index = in.readInt();
+                String path = in.readUTF();
+                ShardProtocol.writeResult(out,
+                    Analyzer.analyzeFile(index, new File(path), triage));
+            }
+            out.writeByte(ShardProtocol.DONE);
+            out.flush();
+        }
+    }
+}
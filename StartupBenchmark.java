@@ -0,0 +1,200 @@
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.io.Reader;
+import java.io.StringReader;
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * Measures the fixed cost of a single-file run, which is what editor and
+ * commit hook invocations pay: each run is a fresh JVM that analyzes one
+ * file, and reports how long after the JVM was started
+ *
+ *   main     its main method was entered,
+ *   read     the file was read (this includes loading Analyzer and the
+ *            management classes that the measurement itself needs),
+ *   tables   the Scanner class was initialized, i.e. Scanner.tables
+ *            was mapped and its character maps copied out (the DFA
+ *            states of each pass are copied in as the pass begins, so
+ *            that cost falls under first and done),
+ *   first    the first finding was returned,
+ *   done     all six passes were over,
+ *
+ * and the parent prints the median and minimum of each over all runs.
+ * Extra JVM options, such as a class data sharing archive, are passed
+ * on to every run so that their effect on startup can be compared.
+ *
+ * Usage: java StartupBenchmark [--runs N] [--jvm OPTION]... <file>
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class StartupBenchmark
+{
+    private static final String CHILD = "--child";
+    private static final String[] PHASES = {
+        "main", "read", "tables", "first", "done"};
+
+    /**
+     * Runs the benchmark, or one measured run if started with --child.
+     *
+     * @param args command line arguments
+     */
+    public static void main (String[] args)
+        throws IOException, InterruptedException
+    {
+        if (args.length == 2 && args[0].equals(CHILD))
+        {
+            child(args[1]);
+            return;
+        }
+
+        int runs = 20;
+        List<String> jvmOptions = new ArrayList<>();
+        String fileName = null;
+        try
+        {
+            for (int i = 0; i < args.length; i++)
+            {
+                switch (args[i])
+                {
+                    case "--runs":
+                        runs = Integer.parseInt(args[++i]);
+                        break;
+                    case "--jvm":
+                        jvmOptions.add(args[++i]);
+                        break;
+                    default:
+                        fileName = args[i];
+                        break;
+                }
+            }
+        }
+        catch (ArrayIndexOutOfBoundsException | NumberFormatException e)
+        {
+            fileName = null;
+        }
+        if (fileName == null || runs < 1)
+        {
+            System.out.println("Usage: java StartupBenchmark [--runs N]"
+                + " [--jvm OPTION]... <file>");
+            return;
+        }
+
+        List<String> command = new ArrayList<>();
+        command.add(System.getProperty("java.home") + File.separator + "bin"
+            + File.separator + "java");
+        command.addAll(jvmOptions);
+        command.add("-cp");
+        command.add(System.getProperty("java.class.path"));
+        command.add("StartupBenchmark");
+        command.add(CHILD);
+        command.add(fileName);
+
+        double[][] millis = new double[PHASES.length + 1][runs];
+        for (int run = 0; run < runs; run++)
+        {
+            long start = System.nanoTime();
+            Process process = new ProcessBuilder(command)
+                .redirectError(ProcessBuilder.Redirect.INHERIT)
+                .start();
+            String line;
+            try (BufferedReader reader = new BufferedReader(
+                new InputStreamReader(process.getInputStream())))
+            {
+                line = reader.readLine();
+            }
+            if (process.waitFor() != 0 || line == null)
+            {
+                System.out.println("Run " + (run + 1) + " failed");
+                return;
+            }
+            millis[PHASES.length][run] = (System.nanoTime() - start) / 1e6;
+            String[] fields = line.trim().split(" ");
+            for (int p = 0; p < PHASES.length; p++)
+            {
+                millis[p][run] = Double.parseDouble(fields[p]);
+            }
+        }
+
+        System.out.printf("%d runs of %s %s\n", runs, fileName,
+            jvmOptions.isEmpty() ? "" : jvmOptions);
+        System.out.printf("  %-8s %10s %10s\n", "", "median ms", "min ms");
+        for (int p = 0; p <= PHASES.length; p++)
+        {
+            double[] values = millis[p];
+            Arrays.sort(values);
+            System.out.printf("  %-8s %10.1f %10.1f\n",
+                p < PHASES.length ? PHASES[p] : "process", values[runs / 2],
+                values[0]);
+        }
+    }
+
+    /**
+     * One measured run: prints the milliseconds from JVM start to each
+     * phase on a single line.
+     */
+    private static void child(String fileName) throws IOException
+    {
+        long entered = System.currentTimeMillis();
+        // loads the management classes, so it comes after the first mark
+        long started = ManagementFactory.getRuntimeMXBean().getStartTime();
+        double[] phases = new double[PHASES.length];
+        phases[0] = entered - started;
+        String source = Analyzer.readSource(new File(fileName));
+        Reader reader = new StringReader(source);
+        reader.mark(source.length() + 1);
+        phases[1] = sinceStart(started);
+        try
+        {
+            Class.forName("Scanner"); // runs its static initializer
+        }
+        catch (ClassNotFoundException e)
+        {
+            throw new IllegalStateException(e);
+        }
+        phases[2] = sinceStart(started);
+        Scanner scanner = new Scanner(reader);
+        scanner.verbose = false;
+        while (true)
+        {
+            Scanner.Token nextToken = scanner.nextToken();
+            if (nextToken.error.equals("EOF"))
+            {
+                break;
+            }
+            if (phases[3] == 0 && !nextToken.error.equals(""))
+            {
+                phases[3] = sinceStart(started);
+            }
+        }
+        phases[4] = sinceStart(started);
+        if (phases[3] == 0)
+        {
+            phases[3] = phases[4]; // a clean file: nothing came sooner
+        }
+
+        StringBuilder line = new StringBuilder();
+        for (double phase : phases)
+        {
+            line.append(String.format(Locale.ROOT, "%.3f ", phase));
+        }
+        System.out.println(line.toString().trim());
+    }
+
+    /**
+     * @param started the runtime's start time
+     * @return milliseconds since the JVM was started, as near as the
+     *         runtime's start time allows
+     */
+    private static double sinceStart(long started)
+    {
+        return System.currentTimeMillis() - started;
+    }
+}
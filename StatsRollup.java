@@ -0,0 +1,147 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.LongAdder;
+
+/**
+ * Counts the findings of a batch run per rule, per directory and per
+ * severity (sure errors and warnings) as the results arrive, and writes
+ * the totals as CSV for dashboards:
+ *
+ *   kind,directory,rule,files,errors,warnings
+ *   rule,,7. Magic number,,120,3400          (the whole repository)
+ *   directory,src/net,,42,80,900             (src/net and everything
+ *   directory_rule,src/net,7. Magic number,,10,300   below it)
+ *
+ * Only counters are kept, one LongAdder per rule and severity for every
+ * directory that directly holds a file, so the memory used does not grow
+ * with the number of findings and results may be counted by several
+ * threads at once. The totals of the directory tree are added up when
+ * the report is written.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class StatsRollup implements ResultSink
+{
+    private static final int RULES = Rule.values().length;
+    private static final int FILES = 2 * RULES; // index of the file count
+    private static final int COUNTERS = FILES + 1;
+
+    private final ConcurrentHashMap<String, LongAdder[]> directories =
+        new ConcurrentHashMap<>();
+
+    /**
+     * Counts the findings of one file.
+     *
+     * @param result the result of one file of the batch
+     */
+    public void accept(FileResult result)
+    {
+        LongAdder[] counters = directories.computeIfAbsent(
+            directoryOf(result.path), directory -> newCounters());
+        counters[FILES].increment();
+        for (Scanner.Token t : result.tokens)
+        {
+            counters[2 * Rule.of(t).ordinal() + (t.sure ? 0 : 1)].increment();
+        }
+    }
+
+    /**
+     * Writes the report.
+     *
+     * @param file where it is written
+     */
+    public void write(File file) throws IOException
+    {
+        // every directory's counts are added to it and all its ancestors
+        Map<String, long[]> tree = new TreeMap<>();
+        long[] repository = new long[COUNTERS];
+        for (Map.Entry<String, LongAdder[]> entry : directories.entrySet())
+        {
+            long[] counts = new long[COUNTERS];
+            for (int i = 0; i < COUNTERS; i++)
+            {
+                counts[i] = entry.getValue()[i].sum();
+                repository[i] += counts[i];
+            }
+            for (String directory = entry.getKey(); directory != null;
+                directory = new File(directory).getParent())
+            {
+                long[] total = tree.computeIfAbsent(directory,
+                    key -> new long[COUNTERS]);
+                for (int i = 0; i < COUNTERS; i++)
+                {
+                    total[i] += counts[i];
+                }
+            }
+        }
+
+        try (PrintWriter out = new PrintWriter(file, "UTF-8"))
+        {
+            out.println("kind,directory,rule,files,errors,warnings");
+            for (Rule rule : Rule.values())
+            {
+                int i = 2 * rule.ordinal();
+                if (repository[i] + repository[i + 1] > 0)
+                {
+                    out.println("rule,," + MetricsWriter.csvField(
+                        rule.toString()) + ",," + repository[i] + ","
+                        + repository[i + 1]);
+                }
+            }
+            for (Map.Entry<String, long[]> entry : tree.entrySet())
+            {
+                String directory = MetricsWriter.csvField(entry.getKey());
+                long[] total = entry.getValue();
+                long errors = 0;
+                long warnings = 0;
+                for (int i = 0; i < FILES; i += 2)
+                {
+                    errors += total[i];
+                    warnings += total[i + 1];
+                }
+                out.println("directory," + directory + ",," + total[FILES]
+                    + "," + errors + "," + warnings);
+                for (Rule rule : Rule.values())
+                {
+                    int i = 2 * rule.ordinal();
+                    if (total[i] + total[i + 1] > 0)
+                    {
+                        out.println("directory_rule," + directory + ","
+                            + MetricsWriter.csvField(rule.toString()) + ",,"
+                            + total[i] + "," + total[i + 1]);
+                    }
+                }
+            }
+            if (out.checkError())
+            {
+                throw new IOException("Could not write the statistics");
+            }
+        }
+    }
+
+    private static LongAdder[] newCounters()
+    {
+        LongAdder[] counters = new LongAdder[COUNTERS];
+        for (int i = 0; i < COUNTERS; i++)
+        {
+            counters[i] = new LongAdder();
+        }
+        return counters;
+    }
+
+    /**
+     * @return the directory holding a file, or "." for a bare file name;
+     *         an archive entry's directory is inside the archive
+     */
+    private static String directoryOf(String path)
+    {
+        String parent = new File(path).getParent();
+        return parent == null ? "." : parent;
+    }
+}
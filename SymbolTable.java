@@ -0,0 +1,164 @@
+
+import java.util.Arrays;
+
+/**
+ * The declared types of the variables in scope, kept in one flat arena
+ * instead of a map per scope.
+ *
+ * Declarations are appended to parallel arrays; opening a scope only
+ * remembers how many there were, and closing it drops everything after
+ * that mark. A single open addressing hash table maps each name to its
+ * newest declaration, and each declaration remembers the one it
+ * shadows, so a lookup is one probe sequence and closing a scope undoes
+ * its declarations in reverse order without searching.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class SymbolTable
+{
+    public static final byte UNKNOWN = 0;
+    public static final byte INTEGER = 1;
+    public static final byte FLOATING = 2;
+
+    private static final int INITIAL_DECLARATIONS = 64;
+    private static final int INITIAL_SLOTS = 128; // a power of two
+    private static final int INITIAL_SCOPES = 16;
+
+    // the arena: one entry per declaration in scope
+    private int[] slotOf = new int[INITIAL_DECLARATIONS];
+    private int[] shadowed = new int[INITIAL_DECLARATIONS];
+    private byte[] typeOf = new byte[INITIAL_DECLARATIONS];
+    private int size = 0;
+
+    // names seen so far -> newest declaration in scope, or -1
+    private String[] names = new String[INITIAL_SLOTS];
+    private int[] newest = new int[INITIAL_SLOTS];
+    private int used = 0;
+
+    private int[] marks = new int[INITIAL_SCOPES];
+    private int depth = 0;
+
+    /**
+     * Starts a scope, e.g. at an opening brace.
+     */
+    public void openScope()
+    {
+        if (depth == marks.length)
+        {
+            marks = Arrays.copyOf(marks, 2 * depth);
+        }
+        marks[depth++] = size;
+    }
+
+    /**
+     * Ends the innermost scope and forgets its declarations. Extra closes
+     * (of braces opened before the table saw them) are ignored.
+     */
+    public void closeScope()
+    {
+        if (depth == 0)
+        {
+            return;
+        }
+        int mark = marks[--depth];
+        while (size > mark)
+        {
+            size--;
+            newest[slotOf[size]] = shadowed[size];
+        }
+    }
+
+    /**
+     * Declares a variable in the innermost scope.
+     *
+     * @param name the variable
+     * @param type INTEGER or FLOATING
+     */
+    public void declare(String name, byte type)
+    {
+        if (size == typeOf.length)
+        {
+            slotOf = Arrays.copyOf(slotOf, 2 * size);
+            shadowed = Arrays.copyOf(shadowed, 2 * size);
+            typeOf = Arrays.copyOf(typeOf, 2 * size);
+        }
+        int slot = slot(name);
+        slotOf[size] = slot;
+        shadowed[size] = newest[slot];
+        typeOf[size] = type;
+        newest[slot] = size++;
+    }
+
+    /**
+     * @param name a variable
+     * @return its declared type, or UNKNOWN if it is not in scope
+     */
+    public byte typeOf(String name)
+    {
+        int mask = names.length - 1;
+        for (int i = name.hashCode() & mask; names[i] != null;
+            i = (i + 1) & mask)
+        {
+            if (names[i].equals(name))
+            {
+                return newest[i] < 0 ? UNKNOWN : typeOf[newest[i]];
+            }
+        }
+        return UNKNOWN;
+    }
+
+    /**
+     * Finds or adds the slot of a name. Slots are never removed, so a
+     * file only ever needs as many as it has distinct names.
+     */
+    private int slot(String name)
+    {
+        if (2 * (used + 1) > names.length)
+        {
+            grow();
+        }
+        int mask = names.length - 1;
+        int i = name.hashCode() & mask;
+        while (names[i] != null)
+        {
+            if (names[i].equals(name))
+            {
+                return i;
+            }
+            i = (i + 1) & mask;
+        }
+        names[i] = name;
+        newest[i] = -1;
+        used++;
+        return i;
+    }
+
+    private void grow()
+    {
+        String[] oldNames = names;
+        int[] oldNewest = newest;
+        int[] moved = new int[oldNames.length];
+        names = new String[2 * oldNames.length];
+        newest = new int[names.length];
+        int mask = names.length - 1;
+        for (int old = 0; old < oldNames.length; old++)
+        {
+            if (oldNames[old] != null)
+            {
+                int i = oldNames[old].hashCode() & mask;
+                while (names[i] != null)
+                {
+                    i = (i + 1) & mask;
+                }
+                names[i] = oldNames[old];
+                newest[i] = oldNewest[old];
+                moved[old] = i;
+            }
+        }
+        for (int d = 0; d < size; d++)
+        {
+            slotOf[d] = moved[slotOf[d]];
+        }
+    }
+}
@@ -0,0 +1,465 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.channels.FileChannel;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+import java.nio.file.StandardOpenOption;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.Arrays;
+import java.util.Set;
+
+/**
+ * The lexical tokens of a C or java file in a compact binary form that
+ * other tools can memory-map and read without lexing the file again.
+ *
+ * The format, big-endian:
+ *
+ *   int    MAGIC, VERSION
+ *   int    length of the text in chars, number of tokens N, number of
+ *          mask words W
+ *   byte   kind of each token (N)
+ *   int    offset of each token in the text (N)
+ *   int    length of each token (N)
+ *   int    line of each token, from 1 (N)
+ *   long   comment mask (W): bit k is set if char k is in a comment
+ *   long   literal mask (W): bit k is set if char k is in a string or
+ *          character literal
+ *
+ * Streams are cached under the SHA-256 of the text they were made from,
+ * so a file that has not changed is never lexed twice, whatever its
+ * path. The Scanner's rules match the raw text, so it does not read the
+ * stream itself.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class TokenStream
+{
+    public static final byte NAME = 1;
+    public static final byte KEYWORD = 2;
+    public static final byte NUMBER = 3;
+    public static final byte STRING = 4;
+    public static final byte CHARACTER = 5;
+    public static final byte COMMENT = 6;
+    public static final byte SYMBOL = 7;
+
+    private static final int MAGIC = 0x4e544f4b; // "NTOK"
+    private static final int VERSION = 1;
+    private static final int HEADER_BYTES = 5 * Integer.BYTES;
+    private static final String EXTENSION = ".tok";
+    private static final Set<String> KEYWORDS = Set.of(
+        "abstract", "auto", "boolean", "break", "byte", "case", "catch",
+        "char", "class", "const", "continue", "default", "do", "double",
+        "else", "enum", "extends", "extern", "final", "finally", "float",
+        "for", "goto", "if", "implements", "import", "instanceof", "int",
+        "interface", "long", "new", "package", "private", "protected",
+        "public", "register", "return", "short", "signed", "sizeof",
+        "static", "struct", "super", "switch", "this", "throw", "throws",
+        "try", "typedef", "union", "unsigned", "void", "volatile", "while");
+    private static final String[] OPERATORS = {
+        ">>>=", "<<=", ">>=", ">>>", "...", "->", "++", "--", "<<", ">>",
+        "<=", ">=", "==", "!=", "&&", "||", "+=", "-=", "*=", "/=", "%=",
+        "&=", "|=", "^=", "::"};
+
+    private final ByteBuffer data;
+    private final int size;
+    private final int kinds;   // where each section starts in data
+    private final int starts;
+    private final int lengths;
+    private final int lines;
+    private final int comments;
+    private final int literals;
+
+    private TokenStream (ByteBuffer data) throws IOException
+    {
+        if (data.limit() < HEADER_BYTES || data.getInt(0) != MAGIC
+            || data.getInt(Integer.BYTES) != VERSION)
+        {
+            throw new IOException("Not a token stream");
+        }
+        this.data = data;
+        this.size = data.getInt(3 * Integer.BYTES);
+        int words = data.getInt(4 * Integer.BYTES);
+        if (size < 0 || words < 0 || HEADER_BYTES + size
+            + 3L * size * Integer.BYTES + 2L * words * Long.BYTES
+            != data.limit())
+        {
+            throw new IOException("Truncated token stream");
+        }
+        this.kinds = HEADER_BYTES;
+        this.starts = kinds + size;
+        this.lengths = starts + size * Integer.BYTES;
+        this.lines = lengths + size * Integer.BYTES;
+        this.comments = lines + size * Integer.BYTES;
+        this.literals = comments + words * Long.BYTES;
+    }
+
+    /**
+     * Returns the stream of a text from the cache, or lexes the text and
+     * adds its stream to the cache.
+     *
+     * @param directory the cache
+     * @param text the contents of a C or java file
+     * @return its tokens
+     */
+    public static TokenStream cached(File directory, CharSequence text)
+        throws IOException
+    {
+        File file = new File(directory, key(text) + EXTENSION);
+        if (file.exists())
+        {
+            try
+            {
+                return map(file);
+            }
+            catch (IOException e)
+            {
+                // a damaged entry is made again
+            }
+        }
+        TokenStream stream = lex(text);
+        stream.write(file);
+        return stream;
+    }
+
+    /**
+     * Maps a stream file into memory.
+     *
+     * @param file a file written by write
+     * @return its tokens, read from the file as they are asked for
+     */
+    public static TokenStream map(File file) throws IOException
+    {
+        try (FileChannel channel = FileChannel.open(file.toPath(),
+            StandardOpenOption.READ))
+        {
+            return new TokenStream(channel.map(FileChannel.MapMode.READ_ONLY,
+                0, channel.size()));
+        }
+    }
+
+    /**
+     * Writes the stream, replacing any old file in one step so that a
+     * reader never maps half of it.
+     *
+     * @param file where it is written
+     */
+    public void write(File file) throws IOException
+    {
+        File temporary = File.createTempFile("tokens", EXTENSION,
+            file.getAbsoluteFile().getParentFile());
+        boolean moved = false;
+        try
+        {
+            try (FileChannel channel = FileChannel.open(temporary.toPath(),
+                StandardOpenOption.WRITE))
+            {
+                ByteBuffer all = data.duplicate();
+                all.clear();
+                while (all.hasRemaining())
+                {
+                    channel.write(all);
+                }
+            }
+            Files.move(temporary.toPath(), file.toPath(),
+                StandardCopyOption.REPLACE_EXISTING,
+                StandardCopyOption.ATOMIC_MOVE);
+            moved = true;
+        }
+        finally
+        {
+            if (!moved)
+            {
+                temporary.delete();
+            }
+        }
+    }
+
+    /**
+     * @param text any text
+     * @return the hex SHA-256 of its UTF-8 encoding
+     */
+    public static String key(CharSequence text)
+    {
+        try
+        {
+            byte[] hash = MessageDigest.getInstance("SHA-256").digest(
+                text.toString().getBytes(StandardCharsets.UTF_8));
+            StringBuilder hex = new StringBuilder(2 * hash.length);
+            for (byte b : hash)
+            {
+                hex.append(String.format("%02x", b));
+            }
+            return hex.toString();
+        }
+        catch (NoSuchAlgorithmException e)
+        {
+            throw new IllegalStateException(e); // every JVM has SHA-256
+        }
+    }
+
+    /**
+     * @return the number of tokens
+     */
+    public int size()
+    {
+        return size;
+    }
+
+    /**
+     * @return the length of the text, in chars
+     */
+    public int textLength()
+    {
+        return data.getInt(2 * Integer.BYTES);
+    }
+
+    /**
+     * @param i a token
+     * @return its kind, e.g. NAME
+     */
+    public byte kind(int i)
+    {
+        return data.get(kinds + i);
+    }
+
+    /**
+     * @param i a token
+     * @return the offset of its first char in the text
+     */
+    public int start(int i)
+    {
+        return data.getInt(starts + i * Integer.BYTES);
+    }
+
+    /**
+     * @param i a token
+     * @return its length in chars
+     */
+    public int length(int i)
+    {
+        return data.getInt(lengths + i * Integer.BYTES);
+    }
+
+    /**
+     * @param i a token
+     * @return the line it starts on, from 1
+     */
+    public int line(int i)
+    {
+        return data.getInt(lines + i * Integer.BYTES);
+    }
+
+    /**
+     * @param offset a char of the text
+     * @return whether it is part of a comment
+     */
+    public boolean inComment(int offset)
+    {
+        return bit(comments, offset);
+    }
+
+    /**
+     * @param offset a char of the text
+     * @return whether it is part of a string or character literal
+     */
+    public boolean inLiteral(int offset)
+    {
+        return bit(literals, offset);
+    }
+
+    private boolean bit(int section, int offset)
+    {
+        long word = data.getLong(section + (offset >>> 6) * Long.BYTES);
+        return (word & (1L << offset)) != 0;
+    }
+
+    /**
+     * Splits a C or java text into tokens.
+     *
+     * @param text the contents of a file
+     * @return its tokens, held in memory
+     */
+    public static TokenStream lex(CharSequence text)
+    {
+        int n = text.length();
+        int capacity = 64;
+        byte[] kind = new byte[capacity];
+        int[] start = new int[capacity];
+        int[] length = new int[capacity];
+        int[] line = new int[capacity];
+        long[] comment = new long[(n + 63) >>> 6];
+        long[] literal = new long[comment.length];
+        int count = 0;
+        int current = 1;
+
+        int i = 0;
+        while (i < n)
+        {
+            char c = text.charAt(i);
+            if (c == '\n')
+            {
+                current++;
+                i++;
+                continue;
+            }
+            if (Character.isWhitespace(c))
+            {
+                i++;
+                continue;
+            }
+            int from = i;
+            int fromLine = current;
+            byte k;
+            char next = i + 1 < n ? text.charAt(i + 1) : 0;
+            if (c == '/' && next == '/')
+            {
+                while (i < n && text.charAt(i) != '\n')
+                {
+                    i++;
+                }
+                k = COMMENT;
+            }
+            else if (c == '/' && next == '*')
+            {
+                i += 2;
+                while (i < n && !(text.charAt(i) == '*' && i + 1 < n
+                    && text.charAt(i + 1) == '/'))
+                {
+                    if (text.charAt(i++) == '\n')
+                    {
+                        current++;
+                    }
+                }
+                i = Math.min(n, i + 2);
+                k = COMMENT;
+            }
+            else if (c == '"' || c == '\'')
+            {
+                // an unterminated literal ends before the end of its line
+                i++;
+                while (i < n && text.charAt(i) != c
+                    && text.charAt(i) != '\n')
+                {
+                    if (text.charAt(i) == '\\' && i + 1 < n)
+                    {
+                        if (text.charAt(i + 1) == '\n')
+                        {
+                            current++; // a continued line
+                        }
+                        i++;
+                    }
+                    i++;
+                }
+                if (i < n && text.charAt(i) == c)
+                {
+                    i++;
+                }
+                k = c == '"' ? STRING : CHARACTER;
+            }
+            else if (Character.isJavaIdentifierStart(c))
+            {
+                while (i < n && Character.isJavaIdentifierPart(text.charAt(i)))
+                {
+                    i++;
+                }
+                k = KEYWORDS.contains(text.subSequence(from, i).toString())
+                    ? KEYWORD : NAME;
+            }
+            else if (Character.isDigit(c)
+                || (c == '.' && Character.isDigit(next)))
+            {
+                while (i < n && (Character.isLetterOrDigit(text.charAt(i))
+                    || text.charAt(i) == '.'
+                    || ((text.charAt(i) == '-' || text.charAt(i) == '+')
+                    && (text.charAt(i - 1) == 'e'
+                    || text.charAt(i - 1) == 'E'))))
+                {
+                    i++;
+                }
+                k = NUMBER;
+            }
+            else
+            {
+                i += operatorLength(text, i);
+                k = SYMBOL;
+            }
+
+            if (k == COMMENT || k == STRING || k == CHARACTER)
+            {
+                long[] mask = k == COMMENT ? comment : literal;
+                for (int j = from; j < i; j++)
+                {
+                    mask[j >>> 6] |= 1L << j;
+                }
+            }
+            if (count == capacity)
+            {
+                capacity *= 2;
+                kind = Arrays.copyOf(kind, capacity);
+                start = Arrays.copyOf(start, capacity);
+                length = Arrays.copyOf(length, capacity);
+                line = Arrays.copyOf(line, capacity);
+            }
+            kind[count] = k;
+            start[count] = from;
+            length[count] = i - from;
+            line[count] = fromLine;
+            count++;
+        }
+
+        ByteBuffer data = ByteBuffer.allocate(HEADER_BYTES + count
+            + 3 * count * Integer.BYTES + 2 * comment.length * Long.BYTES);
+        data.putInt(MAGIC).putInt(VERSION).putInt(n).putInt(count)
+            .putInt(comment.length);
+        data.put(kind, 0, count);
+        data.asIntBuffer().put(start, 0, count);
+        data.position(data.position() + count * Integer.BYTES);
+        data.asIntBuffer().put(length, 0, count);
+        data.position(data.position() + count * Integer.BYTES);
+        data.asIntBuffer().put(line, 0, count);
+        data.position(data.position() + count * Integer.BYTES);
+        data.asLongBuffer().put(comment);
+        data.position(data.position() + comment.length * Long.BYTES);
+        data.asLongBuffer().put(literal);
+        data.clear();
+        try
+        {
+            return new TokenStream(data);
+        }
+        catch (IOException e)
+        {
+            throw new IllegalStateException(e); // it was just written
+        }
+    }
+
+    /**
+     * @return the length of the operator at i: the longest of OPERATORS
+     *         that matches, or 1
+     */
+    private static int operatorLength(CharSequence text, int i)
+    {
+        for (String operator : OPERATORS)
+        {
+            if (i + operator.length() > text.length())
+            {
+                continue;
+            }
+            int j = 0;
+            while (j < operator.length()
+                && text.charAt(i + j) == operator.charAt(j))
+            {
+                j++;
+            }
+            if (j == operator.length())
+            {
+                return j;
+            }
+        }
+        return 1;
+    }
+}
@@ -0,0 +1,186 @@
+
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Locale;
+import java.util.PriorityQueue;
+
+/**
+ * Keeps the K files and the K functions with the most findings per 100
+ * lines, overall and for each rule, while a batch run goes on, and
+ * prints them once it is over.
+ *
+ * Each ranking is a min-heap of at most K entries whose root is the
+ * least dense entry kept, so a file or function only has to beat the
+ * root to get in. Memory use depends on K and the number of rules, not
+ * on the size of the repository. Files and functions shorter than
+ * MIN_LINES are ranked as if they were MIN_LINES long, so a one-line
+ * file with a finding does not top every list.
+ *
+ * Function rankings need the FunctionMetrics of each file, and both
+ * need its line count, which only runs in this JVM provide.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class TopK implements ResultSink
+{
+    private static final int MIN_LINES = 20;
+    private static final int TOTAL = Rule.values().length; // all rules
+
+    private final int k;
+    private final List<PriorityQueue<Entry>> files = new ArrayList<>();
+    private final List<PriorityQueue<Entry>> functions = new ArrayList<>();
+
+    /**
+     * @param k how many files and functions to keep in each ranking
+     */
+    public TopK (int k)
+    {
+        this.k = k;
+        for (int i = 0; i <= TOTAL; i++)
+        {
+            files.add(new PriorityQueue<>());
+            functions.add(new PriorityQueue<>());
+        }
+    }
+
+    /**
+     * Ranks one file and its functions.
+     *
+     * @param result the result of one file of the batch
+     */
+    public synchronized void accept(FileResult result)
+    {
+        if (result.lines == 0 || result.tokens.isEmpty())
+        {
+            return;
+        }
+        offer(files, result.path, result.lines, count(result.tokens, 1,
+            Integer.MAX_VALUE));
+        if (result.functions == null)
+        {
+            return;
+        }
+        for (FunctionMetrics f : result.functions)
+        {
+            offer(functions, result.path + ": " + f.name + " (line "
+                + f.line + ")", f.length, count(result.tokens, f.line,
+                f.line + f.length));
+        }
+    }
+
+    /**
+     * Prints every ranking that has an entry.
+     *
+     * @param out where the rankings are printed
+     */
+    public synchronized void print(PrintStream out)
+    {
+        for (int i = TOTAL; i >= 0; i--)
+        {
+            String rule = i == TOTAL ? "all rules" : Rule.values()[i]
+                .toString();
+            print(out, "files", rule, files.get(i));
+            print(out, "functions", rule, functions.get(i));
+        }
+    }
+
+    private void print(PrintStream out, String kind, String rule,
+        PriorityQueue<Entry> ranking)
+    {
+        if (ranking.isEmpty())
+        {
+            return;
+        }
+        List<Entry> entries = new ArrayList<>(ranking);
+        Collections.sort(entries, Collections.reverseOrder());
+        out.println("==============================");
+        out.printf("Top %d %s by findings per 100 lines, %s:\n",
+            entries.size(), kind, rule);
+        for (Entry entry : entries)
+        {
+            out.printf(Locale.ROOT, "  %8.1f  %6d findings %7d lines  %s\n",
+                entry.density, entry.findings, entry.lines, entry.name);
+        }
+    }
+
+    /**
+     * @param tokens findings, sorted by line
+     * @return the findings on lines first to end - 1 per rule, and in
+     *         the last element in total
+     */
+    private static int[] count(List<Scanner.Token> tokens, int first,
+        int end)
+    {
+        int low = 0;
+        int high = tokens.size();
+        while (low < high)
+        {
+            int middle = (low + high) >>> 1;
+            if (tokens.get(middle).line < first)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+        int[] counts = new int[TOTAL + 1];
+        for (int i = low; i < tokens.size() && tokens.get(i).line < end; i++)
+        {
+            counts[Rule.of(tokens.get(i)).ordinal()]++;
+            counts[TOTAL]++;
+        }
+        return counts;
+    }
+
+    private void offer(List<PriorityQueue<Entry>> rankings, String name,
+        int lines, int[] counts)
+    {
+        for (int i = 0; i <= TOTAL; i++)
+        {
+            if (counts[i] == 0)
+            {
+                continue;
+            }
+            PriorityQueue<Entry> ranking = rankings.get(i);
+            double density = 100.0 * counts[i] / Math.max(lines, MIN_LINES);
+            if (ranking.size() < k)
+            {
+                ranking.add(new Entry(name, lines, counts[i], density));
+            }
+            else if (density > ranking.peek().density)
+            {
+                ranking.poll();
+                ranking.add(new Entry(name, lines, counts[i], density));
+            }
+        }
+    }
+
+    /**
+     * A file or function in a ranking, ordered by density.
+     */
+    private static class Entry implements Comparable<Entry>
+    {
+        final String name;
+        final int lines;
+        final int findings;
+        final double density;
+
+        Entry (String name, int lines, int findings, double density)
+        {
+            this.name = name;
+            this.lines = lines;
+            this.findings = findings;
+            this.density = density;
+        }
+
+        public int compareTo(Entry other)
+        {
+            return Double.compare(density, other.density);
+        }
+    }
+}
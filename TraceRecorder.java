@@ -0,0 +1,185 @@
+
+import java.io.File;
+import java.io.IOException;
+import java.io.PrintWriter;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Queue;
+import java.util.concurrent.ConcurrentLinkedQueue;
+
+/**
+ * Records a timeline of a batch run in the Chrome trace event format,
+ * to be opened in chrome://tracing or Perfetto: one row per thread with
+ * a span for each read, pass and report of each file, and counters for
+ * the depth of the queues between the stages.
+ *
+ * Every thread appends to its own buffer, so recording takes no locks;
+ * the buffers are only joined when the trace is written.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class TraceRecorder
+{
+    private static final int PROCESS_ID = 1;
+
+    private final long origin = System.nanoTime();
+    private final Queue<Buffer> buffers = new ConcurrentLinkedQueue<>();
+    private final ThreadLocal<Buffer> buffer = ThreadLocal.withInitial(() -> {
+        Buffer b = new Buffer(Thread.currentThread());
+        buffers.add(b);
+        return b;
+    });
+
+    /**
+     * @return the current time, to be passed to span later
+     */
+    public long now()
+    {
+        return System.nanoTime();
+    }
+
+    /**
+     * Records a span on the current thread's row that started at the
+     * given time and ends now.
+     *
+     * @param name what was done, e.g. "read" or "pass 3"
+     * @param path the file it was done to
+     * @param start when it started, from now()
+     */
+    public void span(String name, String path, long start)
+    {
+        long end = System.nanoTime();
+        StringBuilder event = new StringBuilder(128);
+        event.append("{\"name\":");
+        quote(event, name);
+        event.append(",\"ph\":\"X\",\"ts\":");
+        micros(event, start - origin);
+        event.append(",\"dur\":");
+        micros(event, end - start);
+        event.append(",\"pid\":").append(PROCESS_ID);
+        event.append(",\"tid\":").append(buffer.get().threadId);
+        event.append(",\"args\":{\"file\":");
+        quote(event, path);
+        event.append("}}");
+        buffer.get().events.add(event.toString());
+    }
+
+    /**
+     * Records the current value of a counter, such as a queue depth.
+     *
+     * @param name the counter
+     * @param value its value now
+     */
+    public void counter(String name, long value)
+    {
+        StringBuilder event = new StringBuilder(96);
+        event.append("{\"name\":");
+        quote(event, name);
+        event.append(",\"ph\":\"C\",\"ts\":");
+        micros(event, System.nanoTime() - origin);
+        event.append(",\"pid\":").append(PROCESS_ID);
+        event.append(",\"args\":{\"depth\":").append(value).append("}}");
+        buffer.get().events.add(event.toString());
+    }
+
+    /**
+     * Writes the trace once the run is over, i.e. once every traced
+     * thread has handed on its last result.
+     *
+     * @param file where the JSON trace is written
+     */
+    public void write(File file) throws IOException
+    {
+        try (PrintWriter out = new PrintWriter(file, "UTF-8"))
+        {
+            out.println("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+            boolean first = true;
+            for (Buffer b : buffers)
+            {
+                StringBuilder name = new StringBuilder(96);
+                name.append("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":")
+                    .append(PROCESS_ID).append(",\"tid\":").append(b.threadId)
+                    .append(",\"args\":{\"name\":");
+                quote(name, b.threadName);
+                name.append("}}");
+                first = print(out, name.toString(), first);
+                for (String event : b.events)
+                {
+                    first = print(out, event, first);
+                }
+            }
+            out.println();
+            out.println("]}");
+            if (out.checkError())
+            {
+                throw new IOException("Could not write trace " + file);
+            }
+        }
+    }
+
+    private static boolean print(PrintWriter out, String event, boolean first)
+    {
+        if (!first)
+        {
+            out.println(",");
+        }
+        out.print(event);
+        return false;
+    }
+
+    /**
+     * Appends nanoseconds as microseconds with three decimals, the unit
+     * of the trace format.
+     */
+    private static void micros(StringBuilder text, long nanos)
+    {
+        text.append(nanos / 1000).append('.');
+        long fraction = nanos % 1000;
+        if (fraction < 100) text.append('0');
+        if (fraction < 10) text.append('0');
+        text.append(fraction);
+    }
+
+    /**
+     * Appends a value as a JSON string, quoted and escaped; also used by
+     * MetricsWriter.
+     */
+    static void quote(StringBuilder text, String value)
+    {
+        text.append('"');
+        for (int i = 0; i < value.length(); i++)
+        {
+            char c = value.charAt(i);
+            if (c == '"' || c == '\\')
+            {
+                text.append('\\').append(c);
+            }
+            else if (c < ' ')
+            {
+                text.append(String.format("\\u%04x", (int) c));
+            }
+            else
+            {
+                text.append(c);
+            }
+        }
+        text.append('"');
+    }
+
+    /**
+     * The events of one thread. Only that thread adds to it.
+     */
+    private static class Buffer
+    {
+        final long threadId;
+        final String threadName;
+        final List<String> events = new ArrayList<>();
+
+        Buffer (Thread thread)
+        {
+            this.threadId = thread.threadId();
+            this.threadName = thread.getName();
+        }
+    }
+}
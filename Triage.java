@@ -0,0 +1,159 @@
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * A cheap look at the first few KB of a file, taken before it is read in
+ * full, that keeps files which are not worth scanning out of the batch.
+ *
+ * Binary files (NUL bytes) and generated files ("generated by", "DO NOT
+ * EDIT" and similar markers) are skipped outright. Minified files, whose
+ * lines are very long on average or which have many lines over the
+ * limit, are only checked for line length, which needs no Scanner.
+ *
+ * @author Elijah Levanon
+ * @version 2026-10-17
+ */
+public class Triage
+{
+    public static final int HEAD_BYTES = 8 * 1024;
+    private static final int MAX_LINE_LENGTH = 132;
+    private static final int MINIFIED_AVERAGE_LINE_LENGTH = 200;
+    private static final int MIN_LONG_LINES = 8;
+    private static final String[] GENERATED_MARKERS = {
+        "generated by", "@generated", "do not edit", "autogenerated",
+        "auto-generated"};
+
+    public final boolean skip; // true to skip, false for line length only
+    public final String reason;
+
+    Triage (boolean skip, String reason)
+    {
+        this.skip = skip;
+        this.reason = reason;
+    }
+
+    /**
+     * Reads the head of a file and decides how to treat it.
+     *
+     * @param file the file to inspect
+     * @return null if the file should be analyzed in full
+     */
+    public static Triage inspect(File file) throws IOException
+    {
+        byte[] head = new byte[HEAD_BYTES];
+        int length;
+        try (InputStream in = new FileInputStream(file))
+        {
+            length = in.readNBytes(head, 0, HEAD_BYTES);
+        }
+        return inspect(head, length);
+    }
+
+    /**
+     * Decides how to treat a file from its first bytes.
+     *
+     * @param head the first bytes of the file
+     * @param length how many bytes of head are valid
+     * @return null if the file should be analyzed in full
+     */
+    public static Triage inspect(byte[] head, int length)
+    {
+        int lines = 0;
+        int longLines = 0;
+        int lineLength = 0;
+        for (int i = 0; i < length; i++)
+        {
+            byte b = head[i];
+            if (b == 0)
+            {
+                return new Triage(true, "binary file (contains NUL bytes)");
+            }
+            if (b == '\n')
+            {
+                if (lineLength > MAX_LINE_LENGTH) longLines++;
+                lines++;
+                lineLength = 0;
+            }
+            else
+            {
+                lineLength++;
+            }
+        }
+        if (lineLength > MAX_LINE_LENGTH) longLines++;
+        if (lineLength > 0) lines++;
+
+        String text = new String(head, 0, length, StandardCharsets.ISO_8859_1)
+            .toLowerCase(Locale.ROOT);
+        for (String marker : GENERATED_MARKERS)
+        {
+            if (text.contains(marker))
+            {
+                return new Triage(true, "generated file (\"" + marker
+                    + "\")");
+            }
+        }
+
+        int averageLineLength = length / Math.max(1, lines);
+        if (averageLineLength > MINIFIED_AVERAGE_LINE_LENGTH ||
+            (longLines >= MIN_LONG_LINES && 4 * longLines > lines))
+        {
+            return new Triage(false, "minified or machine-formatted"
+                + " (average line " + averageLineLength + " chars, "
+                + longLines + " of " + lines + " lines too long)");
+        }
+        return null;
+    }
+
+    /**
+     * The only rule applied to minified files: the line length limit,
+     * checked with a plain loop instead of the Scanner.
+     *
+     * @param source the contents of the file
+     * @return one finding per line that is too long
+     */
+    public static List<Scanner.Token> checkLineLengths(String source)
+    {
+        List<Scanner.Token> tokens = new ArrayList<>();
+        int line = 1;
+        int start = 0;
+        for (int i = 0; i <= source.length(); i++)
+        {
+            if (i == source.length() || source.charAt(i) == '\n')
+            {
+                int end = (i > start && source.charAt(i - 1) == '\r')
+                    ? i - 1 : i;
+                Scanner.Token token = checkLineLength(end - start, line);
+                if (token != null)
+                {
+                    tokens.add(token);
+                }
+                line++;
+                start = i + 1;
+            }
+        }
+        return tokens;
+    }
+
+    /**
+     * @param length length of a line, without its line terminator
+     * @param line its line number
+     * @return the finding for the line if it is too long, else null
+     */
+    static Scanner.Token checkLineLength(int length, int line)
+    {
+        return length > MAX_LINE_LENGTH
+            ? new Scanner.Token("Line exceeds 132 lines", line, true) : null;
+    }
+
+    public String toString()
+    {
+        return (skip ? "skipped: " : "line length only: ") + reason;
+    }
+}